@@ -0,0 +1,339 @@
+//--------------------------------------------------
+// Implementation of class CameraModel
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "CameraModel.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor. The remap tables and the per-pixel rays are built once here, after which the model is
+ * never changed, so that a single instance can be shared by any number of worker threads.
+ * @param calibration The calibration of the camera
+ */
+CameraModel::CameraModel(MonoCalibration& calibration) : _imageSize(calibration.GetImageSize())
+{
+	Initialize(calibration.GetCamera(), calibration.GetDistortion());
+}
+
+/**
+ * @brief Main Constructor
+ * @param camera The 3x3 CV_64F camera matrix
+ * @param distortion The distortion coefficients (k1, k2, p1, p2[, k3[, k4, k5, k6]]), or an empty matrix for none
+ * @param imageSize The size of the images of the camera
+ */
+CameraModel::CameraModel(Mat& camera, Mat& distortion, const Size& imageSize) : _imageSize(imageSize)
+{
+	Initialize(camera, distortion);
+}
+
+/**
+ * @brief Shared construction logic
+ * @param camera The 3x3 CV_64F camera matrix
+ * @param distortion The distortion coefficients
+ */
+void CameraModel::Initialize(Mat& camera, Mat& distortion)
+{
+	if (_imageSize.width <= 0 || _imageSize.height <= 0) throw runtime_error("The image size of the camera is expected to be positive");
+
+	_camera = PinholeCamera::FromMat(camera);
+
+	for (auto i = 0; i < 8; i++) _distortion[i] = 0;
+	_hasDistortion = false;
+
+	if (!distortion.empty())
+	{
+		auto count = (int)distortion.total();
+		if (count != 4 && count != 5 && count != 8) throw runtime_error("Unsupported number of distortion coefficients: " + to_string(count));
+
+		Mat values; distortion.convertTo(values, CV_64F);
+		for (auto i = 0; i < count; i++) { _distortion[i] = ((double *)values.data)[i]; _hasDistortion |= _distortion[i] != 0; }
+	}
+
+	BuildMaps();
+	BuildRays();
+}
+
+//--------------------------------------------------
+// Image Operations
+//--------------------------------------------------
+
+/**
+ * @brief Remove the distortion from an image, using the precomputed remap tables (the camera matrix is unchanged)
+ * @param image The image that we are undistorting
+ * @param output The undistorted image
+ * @param interpolation The interpolation used when sampling the image
+ */
+void CameraModel::Undistort(const Mat& image, Mat& output, int interpolation) const
+{
+	if (image.cols != _imageSize.width || image.rows != _imageSize.height) throw runtime_error("The image does not match the size of the camera");
+	remap(image, output, _mapX, _mapY, interpolation, BORDER_CONSTANT);
+}
+
+/**
+ * @brief Convert a depth map (aligned with the distorted image) into points, using the per-pixel rays
+ * @param depth The depth map (CV_16U, CV_32F or CV_64F)
+ * @param output The resultant points (CV_64FC3), zero where there is no depth
+ * @param depthScale The scale applied to the depth values
+ */
+void CameraModel::UnProjectDepth(const Mat& depth, Mat& output, double depthScale) const
+{
+	if (depth.cols != _imageSize.width || depth.rows != _imageSize.height) throw runtime_error("The depth map does not match the size of the camera");
+	if (depth.type() != CV_16U && depth.type() != CV_32F && depth.type() != CV_64F) throw runtime_error("Unsupported depth map type");
+
+	output = Mat(depth.rows, depth.cols, CV_64FC3);
+
+	parallel_for_(cv::Range(0, depth.rows), [&](const cv::Range& range)
+	{
+		for (auto row = range.start; row < range.end; row++)
+		{
+			auto line = output.ptr<Vec3d>(row);
+			if (depth.type() == CV_16U) UnProjectRow(depth.ptr<ushort>(row), row, depthScale, line);
+			else if (depth.type() == CV_32F) UnProjectRow(depth.ptr<float>(row), row, depthScale, line);
+			else UnProjectRow(depth.ptr<double>(row), row, depthScale, line);
+		}
+	});
+}
+
+/**
+ * @brief Convert a row of a depth map into points
+ * @param depth The depth values of the row
+ * @param row The index of the row
+ * @param depthScale The scale applied to the depth values
+ * @param output The points of the row
+ */
+template <typename T> void CameraModel::UnProjectRow(const T * depth, int row, double depthScale, Vec3d * output) const
+{
+	auto rays = _rays.ptr<Vec2d>(row);
+
+	for (auto column = 0; column < _imageSize.width; column++)
+	{
+		auto Z = depth[column] * depthScale;
+		output[column] = Z > 0 ? Vec3d(rays[column][0] * Z, rays[column][1] * Z, Z) : Vec3d();
+	}
+}
+
+//--------------------------------------------------
+// Point Operations
+//--------------------------------------------------
+
+/**
+ * @brief Add the lens distortion to a set of ideal (undistorted) pixels
+ * @param points The ideal pixels
+ * @param output The distorted pixels (may be the same array as the input)
+ * @param count The number of points
+ */
+void CameraModel::DistortPoints(const Point2d * points, Point2d * output, size_t count) const
+{
+	Math3D::RunParallel(count, GRAIN_SIZE, [&](size_t first, size_t last)
+	{
+		for (auto i = first; i < last; i++)
+		{
+			auto normal = Distort(Point2d((points[i].x - _camera.GetCx()) / _camera.GetFx(), (points[i].y - _camera.GetCy()) / _camera.GetFy()));
+			output[i] = Point2d(_camera.GetFx() * normal.x + _camera.GetCx(), _camera.GetFy() * normal.y + _camera.GetCy());
+		}
+	});
+}
+
+/**
+ * @brief Remove the lens distortion from a set of pixels. Pixels within the image start from the precomputed rays,
+ * so only a couple of refinement steps are needed.
+ * @param points The distorted pixels
+ * @param output The ideal pixels (may be the same array as the input)
+ * @param count The number of points
+ */
+void CameraModel::UndistortPoints(const Point2d * points, Point2d * output, size_t count) const
+{
+	Math3D::RunParallel(count, GRAIN_SIZE, [&](size_t first, size_t last)
+	{
+		for (auto i = first; i < last; i++)
+		{
+			auto normal = FindRay(points[i]);
+			output[i] = Point2d(_camera.GetFx() * normal.x + _camera.GetCx(), _camera.GetFy() * normal.y + _camera.GetCy());
+		}
+	});
+}
+
+/**
+ * @brief Project a set of points (in the frame of the camera) into the distorted image
+ * @param points The points that we are projecting
+ * @param output The resultant pixels
+ * @param count The number of points
+ */
+void CameraModel::ProjectPoints(const Point3d * points, Point2d * output, size_t count) const
+{
+	ProjectPoints(Pose3d(), points, output, count);
+}
+
+/**
+ * @brief Project a set of world points into the distorted image
+ * @param pose The pose that maps world points into the frame of the camera
+ * @param points The points that we are projecting
+ * @param output The resultant pixels
+ * @param count The number of points
+ */
+void CameraModel::ProjectPoints(const Pose3d& pose, const Point3d * points, Point2d * output, size_t count) const
+{
+	Math3D::RunParallel(count, GRAIN_SIZE, [&](size_t first, size_t last)
+	{
+		for (auto i = first; i < last; i++)
+		{
+			auto point = pose.Apply(points[i]);
+			auto normal = Distort(Point2d(point.x / point.z, point.y / point.z));
+			output[i] = Point2d(_camera.GetFx() * normal.x + _camera.GetCx(), _camera.GetFy() * normal.y + _camera.GetCy());
+		}
+	});
+}
+
+/**
+ * @brief Lift a set of distorted pixels into points (in the frame of the camera)
+ * @param points The distorted pixels
+ * @param depth The depth (Z) of each of the pixels
+ * @param output The resultant points
+ * @param count The number of points
+ */
+void CameraModel::UnProjectPoints(const Point2d * points, const double * depth, Point3d * output, size_t count) const
+{
+	Math3D::RunParallel(count, GRAIN_SIZE, [&](size_t first, size_t last)
+	{
+		for (auto i = first; i < last; i++)
+		{
+			auto normal = FindRay(points[i]);
+			output[i] = Point3d(normal.x * depth[i], normal.y * depth[i], depth[i]);
+		}
+	});
+}
+
+//--------------------------------------------------
+// Distortion Model
+//--------------------------------------------------
+
+/**
+ * @brief Apply the distortion model to a normalized point (X / Z, Y / Z)
+ * @param point The ideal normalized point
+ * @return Point2d The distorted normalized point
+ */
+Point2d CameraModel::Distort(const Point2d& point) const
+{
+	if (!_hasDistortion) return point;
+
+	auto k = _distortion; auto x = point.x; auto y = point.y;
+	auto r2 = x * x + y * y;
+	auto radial = (1 + ((k[4] * r2 + k[1]) * r2 + k[0]) * r2) / (1 + ((k[7] * r2 + k[6]) * r2 + k[5]) * r2);
+
+	return Point2d(x * radial + 2 * k[2] * x * y + k[3] * (r2 + 2 * x * x), y * radial + k[2] * (r2 + 2 * y * y) + 2 * k[3] * x * y);
+}
+
+/**
+ * @brief Invert the distortion model for a normalized point, with a fixed point iteration
+ * @param point The distorted normalized point
+ * @param guess The starting estimate of the ideal point
+ * @return Point2d The ideal normalized point
+ */
+Point2d CameraModel::Undistort(const Point2d& point, const Point2d& guess) const
+{
+	if (!_hasDistortion) return point;
+
+	auto k = _distortion; auto x = guess.x; auto y = guess.y;
+
+	for (auto iteration = 0; iteration < MAX_ITERATIONS; iteration++)
+	{
+		auto r2 = x * x + y * y;
+		auto inverse = (1 + ((k[7] * r2 + k[6]) * r2 + k[5]) * r2) / (1 + ((k[4] * r2 + k[1]) * r2 + k[0]) * r2);
+		auto deltaX = 2 * k[2] * x * y + k[3] * (r2 + 2 * x * x);
+		auto deltaY = k[2] * (r2 + 2 * y * y) + 2 * k[3] * x * y;
+
+		auto nextX = (point.x - deltaX) * inverse; auto nextY = (point.y - deltaY) * inverse;
+		auto change = fabs(nextX - x) + fabs(nextY - y);
+		x = nextX; y = nextY;
+
+		if (change < 1e-14) break;
+	}
+
+	return Point2d(x, y);
+}
+
+//--------------------------------------------------
+// Tables
+//--------------------------------------------------
+
+/**
+ * @brief Build the remap tables that take each ideal pixel to its location within the distorted image
+ * (matching initUndistortRectifyMap with no rectification and an unchanged camera matrix)
+ */
+void CameraModel::BuildMaps()
+{
+	_mapX = Mat(_imageSize, CV_32FC1); _mapY = Mat(_imageSize, CV_32FC1);
+
+	parallel_for_(cv::Range(0, _imageSize.height), [&](const cv::Range& range)
+	{
+		for (auto row = range.start; row < range.end; row++)
+		{
+			auto mapX = _mapX.ptr<float>(row); auto mapY = _mapY.ptr<float>(row);
+			auto y = (row - _camera.GetCy()) / _camera.GetFy();
+
+			for (auto column = 0; column < _imageSize.width; column++)
+			{
+				auto normal = Distort(Point2d((column - _camera.GetCx()) / _camera.GetFx(), y));
+				mapX[column] = (float)(_camera.GetFx() * normal.x + _camera.GetCx());
+				mapY[column] = (float)(_camera.GetFy() * normal.y + _camera.GetCy());
+			}
+		}
+	});
+}
+
+/**
+ * @brief Build the ideal normalized ray (X / Z, Y / Z) of every pixel of the distorted image. Each pixel starts
+ * from the ray of its neighbour, which is close, so the iteration converges quickly.
+ */
+void CameraModel::BuildRays()
+{
+	_rays = Mat(_imageSize, CV_64FC2);
+
+	parallel_for_(cv::Range(0, _imageSize.height), [&](const cv::Range& range)
+	{
+		for (auto row = range.start; row < range.end; row++)
+		{
+			auto rays = _rays.ptr<Vec2d>(row);
+			auto y = (row - _camera.GetCy()) / _camera.GetFy(); auto guess = Point2d();
+
+			for (auto column = 0; column < _imageSize.width; column++)
+			{
+				auto point = Point2d((column - _camera.GetCx()) / _camera.GetFx(), y);
+				guess = Undistort(point, column == 0 ? point : guess);
+				rays[column] = Vec2d(guess.x, guess.y);
+			}
+		}
+	});
+}
+
+/**
+ * @brief Find the ideal normalized ray of a distorted pixel. The rays table is interpolated for pixels within the
+ * image and then refined; pixels outside the image are solved from scratch.
+ * @param pixel The distorted pixel
+ * @return Point2d The ideal normalized ray (X / Z, Y / Z)
+ */
+Point2d CameraModel::FindRay(const Point2d& pixel) const
+{
+	auto point = Point2d((pixel.x - _camera.GetCx()) / _camera.GetFx(), (pixel.y - _camera.GetCy()) / _camera.GetFy());
+	if (!_hasDistortion) return point;
+
+	if (!(pixel.x >= 0 && pixel.y >= 0 && pixel.x <= _imageSize.width - 1 && pixel.y <= _imageSize.height - 1)) return Undistort(point, point);
+
+	auto x0 = min((int)pixel.x, max(_imageSize.width - 2, 0)); auto x1 = min(x0 + 1, _imageSize.width - 1);
+	auto y0 = min((int)pixel.y, max(_imageSize.height - 2, 0)); auto y1 = min(y0 + 1, _imageSize.height - 1);
+	auto fx = pixel.x - x0; auto fy = pixel.y - y0;
+
+	auto top = _rays.ptr<Vec2d>(y0)[x0] * (1 - fx) + _rays.ptr<Vec2d>(y0)[x1] * fx;
+	auto bottom = _rays.ptr<Vec2d>(y1)[x0] * (1 - fx) + _rays.ptr<Vec2d>(y1)[x1] * fx;
+	auto guess = top * (1 - fy) + bottom * fy;
+
+	return Undistort(point, Point2d(guess[0], guess[1]));
+}
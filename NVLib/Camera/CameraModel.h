@@ -0,0 +1,69 @@
+//--------------------------------------------------
+// Utility: A distortion aware camera, with the undistortion tables of a calibration precomputed
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <functional>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "../Math3D.h"
+#include "../Model/MonoCalibration.h"
+#include "../Model/PinholeCamera.h"
+#include "../Model/Pose3d.h"
+
+namespace NVLib
+{
+	class CameraModel
+	{
+	private:
+		// The largest number of iterations used to invert the distortion of a point
+		static constexpr int MAX_ITERATIONS = 20;
+
+		// The smallest number of points that is worth handing to a worker thread
+		static constexpr size_t GRAIN_SIZE = 1024;
+
+		PinholeCamera _camera;
+		double _distortion[8];
+		bool _hasDistortion;
+		Size _imageSize;
+		Mat _mapX;
+		Mat _mapY;
+		Mat _rays;
+	public:
+		CameraModel(MonoCalibration& calibration);
+		CameraModel(Mat& camera, Mat& distortion, const Size& imageSize);
+
+		void Undistort(const Mat& image, Mat& output, int interpolation = INTER_LINEAR) const;
+		void DistortPoints(const Point2d * points, Point2d * output, size_t count) const;
+		void UndistortPoints(const Point2d * points, Point2d * output, size_t count) const;
+		void ProjectPoints(const Point3d * points, Point2d * output, size_t count) const;
+		void ProjectPoints(const Pose3d& pose, const Point3d * points, Point2d * output, size_t count) const;
+		void UnProjectPoints(const Point2d * points, const double * depth, Point3d * output, size_t count) const;
+		void UnProjectDepth(const Mat& depth, Mat& output, double depthScale = 1.0) const;
+
+		Point2d Distort(const Point2d& point) const;
+		Point2d Undistort(const Point2d& point, const Point2d& guess) const;
+
+		inline const PinholeCamera& GetCamera() const { return _camera; }
+		inline const Size& GetImageSize() const { return _imageSize; }
+		inline bool HasDistortion() const { return _hasDistortion; }
+		inline const Mat& GetMapX() const { return _mapX; }
+		inline const Mat& GetMapY() const { return _mapY; }
+		inline const Mat& GetRays() const { return _rays; }
+	private:
+		void Initialize(Mat& camera, Mat& distortion);
+		void BuildMaps();
+		void BuildRays();
+		Point2d FindRay(const Point2d& pixel) const;
+		template <typename T> void UnProjectRow(const T * depth, int row, double depthScale, Vec3d * output) const;
+	};
+}
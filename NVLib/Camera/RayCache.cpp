@@ -0,0 +1,216 @@
+//--------------------------------------------------
+// Implementation of class RayCache
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "RayCache.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Key
+//--------------------------------------------------
+
+/**
+ * @brief Order the keys, so that they can be used within a map
+ * @param other The key that we are comparing against
+ * @return bool True if this key comes before the other key
+ */
+bool RayKey::operator<(const RayKey& other) const
+{
+	if (Width != other.Width) return Width < other.Width;
+	if (Height != other.Height) return Height < other.Height;
+	return lexicographical_compare(Values, Values + 12, other.Values, other.Values + 12);
+}
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param memoryLimit The number of bytes that the cached tables may take up (the newest table is always kept)
+ */
+RayCache::RayCache(size_t memoryLimit) : _memoryLimit(memoryLimit), _memoryUsed(0)
+{
+	// Extra implementation can go here
+}
+
+/**
+ * @brief Retrieve the cache that is shared by the library
+ * @return RayCache& The shared cache
+ */
+RayCache& RayCache::GetDefault()
+{
+	static RayCache cache;
+	return cache;
+}
+
+//--------------------------------------------------
+// Retrieval
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve the rays of a pinhole camera
+ * @param camera The 3x3 CV_64F camera matrix
+ * @param imageSize The size of the images of the camera
+ * @return Mat The rays (CV_64FC2), holding ((u - cx) / fx, (v - cy) / fy) for each pixel
+ */
+Mat RayCache::GetRays(Mat& camera, const Size& imageSize)
+{
+	Mat distortion; return GetRays(camera, distortion, imageSize);
+}
+
+/**
+ * @brief Retrieve the rays of a camera, building them on the first request. The returned table shares its data
+ * with the cache, so it stays valid after it has been evicted, and must not be written to.
+ * @param camera The 3x3 CV_64F camera matrix
+ * @param distortion The distortion coefficients (empty for a pinhole camera)
+ * @param imageSize The size of the images of the camera
+ * @return Mat The rays (CV_64FC2), holding the ideal (X / Z, Y / Z) of each pixel of the distorted image
+ */
+Mat RayCache::GetRays(Mat& camera, Mat& distortion, const Size& imageSize)
+{
+	auto key = GetKey(camera, distortion, imageSize);
+
+	{
+		lock_guard<mutex> guard(_mutex);
+
+		auto entry = _lookup.find(key);
+		if (entry != _lookup.end())
+		{
+			_entries.splice(_entries.begin(), _entries, entry->second);
+			return entry->second->second;
+		}
+	}
+
+	// The table is built outside the lock, so that other cameras are not held up
+	auto rays = BuildRays(camera, distortion, imageSize);
+
+	lock_guard<mutex> guard(_mutex);
+
+	auto entry = _lookup.find(key);
+	if (entry != _lookup.end()) return entry->second->second;
+
+	_entries.push_front(make_pair(key, rays));
+	_lookup[key] = _entries.begin();
+	_memoryUsed += rays.total() * rays.elemSize();
+	Trim();
+
+	return rays;
+}
+
+//--------------------------------------------------
+// Memory Management
+//--------------------------------------------------
+
+/**
+ * @brief Update the memory limit, evicting tables if it is now exceeded
+ * @param memoryLimit The number of bytes that the cached tables may take up
+ */
+void RayCache::SetMemoryLimit(size_t memoryLimit)
+{
+	lock_guard<mutex> guard(_mutex);
+	_memoryLimit = memoryLimit;
+	Trim();
+}
+
+/**
+ * @brief Remove all the tables from the cache
+ */
+void RayCache::Clear()
+{
+	lock_guard<mutex> guard(_mutex);
+	_entries.clear(); _lookup.clear(); _memoryUsed = 0;
+}
+
+/**
+ * @brief Retrieve the number of bytes taken up by the cached tables
+ * @return size_t The number of bytes
+ */
+size_t RayCache::GetMemoryUsed()
+{
+	lock_guard<mutex> guard(_mutex);
+	return _memoryUsed;
+}
+
+/**
+ * @brief Retrieve the number of cached tables
+ * @return size_t The number of tables
+ */
+size_t RayCache::GetCount()
+{
+	lock_guard<mutex> guard(_mutex);
+	return _entries.size();
+}
+
+/**
+ * @brief Evict the least recently used tables until the cache is within its memory limit (the caller holds the lock)
+ */
+void RayCache::Trim()
+{
+	while (_memoryUsed > _memoryLimit && _entries.size() > 1)
+	{
+		auto& oldest = _entries.back();
+		_memoryUsed -= oldest.second.total() * oldest.second.elemSize();
+		_lookup.erase(oldest.first);
+		_entries.pop_back();
+	}
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Build the key of a camera
+ * @param camera The 3x3 CV_64F camera matrix
+ * @param distortion The distortion coefficients (empty for a pinhole camera)
+ * @param imageSize The size of the images of the camera
+ * @return RayKey The resultant key
+ */
+RayKey RayCache::GetKey(Mat& camera, Mat& distortion, const Size& imageSize)
+{
+	auto pinhole = PinholeCamera::FromMat(camera);
+
+	auto result = RayKey(); result.Width = imageSize.width; result.Height = imageSize.height;
+	for (auto i = 0; i < 12; i++) result.Values[i] = 0;
+	result.Values[0] = pinhole.GetFx(); result.Values[1] = pinhole.GetFy(); result.Values[2] = pinhole.GetCx(); result.Values[3] = pinhole.GetCy();
+
+	if (!distortion.empty())
+	{
+		if (distortion.total() > 8) throw runtime_error("Unsupported number of distortion coefficients: " + to_string(distortion.total()));
+		Mat values; distortion.convertTo(values, CV_64F);
+		for (auto i = 0; i < (int)values.total(); i++) result.Values[4 + i] = ((double *)values.data)[i];
+	}
+
+	return result;
+}
+
+/**
+ * @brief Build the rays of a camera. Pinhole rays are found directly, while distorted rays come from a camera model.
+ * @param camera The 3x3 CV_64F camera matrix
+ * @param distortion The distortion coefficients (empty for a pinhole camera)
+ * @param imageSize The size of the images of the camera
+ * @return Mat The rays (CV_64FC2)
+ */
+Mat RayCache::BuildRays(Mat& camera, Mat& distortion, const Size& imageSize)
+{
+	if (!distortion.empty()) return CameraModel(camera, distortion, imageSize).GetRays();
+
+	auto pinhole = PinholeCamera::FromMat(camera);
+	Mat result = Mat(imageSize, CV_64FC2);
+
+	parallel_for_(cv::Range(0, imageSize.height), [&](const cv::Range& range)
+	{
+		for (auto row = range.start; row < range.end; row++)
+		{
+			auto rays = result.ptr<Vec2d>(row); auto yray = (row - pinhole.GetCy()) / pinhole.GetFy();
+			for (auto column = 0; column < imageSize.width; column++) rays[column] = Vec2d((column - pinhole.GetCx()) / pinhole.GetFx(), yray);
+		}
+	});
+
+	return result;
+}
@@ -0,0 +1,62 @@
+//--------------------------------------------------
+// Utility: A least recently used cache of the per-pixel unprojection rays of the cameras in use
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <map>
+#include <list>
+#include <mutex>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "CameraModel.h"
+
+namespace NVLib
+{
+	/**
+	 * The values that identify a rays table: the intrinsics (fx, fy, cx, cy), the distortion and the image size
+	 */
+	struct RayKey
+	{
+		double Values[12];
+		int Width;
+		int Height;
+
+		bool operator<(const RayKey& other) const;
+	};
+
+	class RayCache
+	{
+	private:
+		mutex _mutex;
+		size_t _memoryLimit;
+		size_t _memoryUsed;
+		list<pair<RayKey, Mat>> _entries;
+		map<RayKey, list<pair<RayKey, Mat>>::iterator> _lookup;
+	public:
+		RayCache(size_t memoryLimit = 1 << 27);
+
+		Mat GetRays(Mat& camera, const Size& imageSize);
+		Mat GetRays(Mat& camera, Mat& distortion, const Size& imageSize);
+		void SetMemoryLimit(size_t memoryLimit);
+		void Clear();
+
+		size_t GetMemoryUsed();
+		size_t GetCount();
+		inline size_t GetMemoryLimit() { return _memoryLimit; }
+
+		static RayCache& GetDefault();
+	private:
+		void Trim();
+		static RayKey GetKey(Mat& camera, Mat& distortion, const Size& imageSize);
+		static Mat BuildRays(Mat& camera, Mat& distortion, const Size& imageSize);
+	};
+}
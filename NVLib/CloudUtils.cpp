@@ -20,35 +20,158 @@ using namespace NVLib;
  */
 Mat CloudUtils::BuildColorCloud(Mat& camera, Mat& color, Mat& depth)
 {
-	Mat result = Mat::zeros(color.size(), CV_64FC(6));
-	
-	auto depthData = (double *)depth.data;
-	auto resultData = (double*)result.data;
+	Mat result; BuildColorCloud(camera, color, depth, result);
+	return result;
+}
+
+/**
+ * Build a color cloud into a caller supplied buffer, reading the depth map in its native format
+ * @param camera The camera matrix that we are working with
+ * @param color The texture associated with the cloud (CV_8UC3)
+ * @param depth The depth associated with the cloud (CV_16U, CV_32F or CV_64F)
+ * @param output The output cloud (CV_64FC(6)), only reallocated if the size or type does not match
+ * @param depthScale The scale factor that converts raw depth values into cloud units
+ */
+void CloudUtils::BuildColorCloud(Mat& camera, Mat& color, Mat& depth, Mat& output, double depthScale)
+{
+	if (color.rows != depth.rows || color.cols != depth.cols) throw runtime_error("The color and depth images need to be the same size");
+	if (color.type() != CV_8UC3) throw runtime_error("The color image is expected to be of type CV_8UC3");
+	if (depth.channels() != 1) throw runtime_error("The depth map can only have 1 channel");
+
+	auto depthType = depth.depth();
+	if (depthType != CV_16U && depthType != CV_32F && depthType != CV_64F) throw runtime_error("Unsupported depth map type: only CV_16U, CV_32F and CV_64F are supported");
+
+	output.create(color.size(), CV_64FC(6));
 
 	auto k = (double *)camera.data;
-	auto fx = k[0];
-	auto fy = k[4];
-	auto cx = k[2];
-	auto cy = k[5];
+	auto fx = k[0]; auto fy = k[4];
+	auto cx = k[2]; auto cy = k[5];
 
-	for (auto row = 0; row < color.rows; row++) 
+	// The x-ray of each column is the same on every row, so it is calculated once
+	auto xrays = vector<double>(color.cols);
+	for (auto column = 0; column < color.cols; column++) xrays[column] = (column - cx) / fx;
+
+	parallel_for_(cv::Range(0, color.rows), [&](const cv::Range& range)
 	{
-		for (auto column = 0; column < color.cols; column++) 
+		for (auto row = range.start; row < range.end; row++)
 		{
-			auto index = column + row * color.cols;
-			auto Z = depthData[index];
-			if (Z == 0) continue;
-			
-			resultData[index * 6 + 0] = (column - cx) * (Z / fx);
-			resultData[index * 6 + 1] = (row - cy) * (Z / fy);
-			resultData[index * 6 + 2] = Z;
-			resultData[index * 6 + 3] = color.data[index * 3 + 0];
-			resultData[index * 6 + 4] = color.data[index * 3 + 1];
-			resultData[index * 6 + 5] = color.data[index * 3 + 2];
-		}	
+			auto yray = (row - cy) / fy;
+			auto colorRow = color.ptr<uchar>(row);
+			auto outputRow = output.ptr<double>(row);
+
+			switch (depthType)
+			{
+				case CV_16U: BuildCloudRow(depth.ptr<ushort>(row), colorRow, &xrays[0], yray, depthScale, outputRow, color.cols); break;
+				case CV_32F: BuildCloudRow(depth.ptr<float>(row), colorRow, &xrays[0], yray, depthScale, outputRow, color.cols); break;
+				default: BuildCloudRow(depth.ptr<double>(row), colorRow, &xrays[0], yray, depthScale, outputRow, color.cols); break;
+			}
+		}
+	});
+}
+
+/**
+ * Build a single row of a color cloud. The loop is kept branch free so that the compiler can vectorize it.
+ * @param depth The depth values of the row
+ * @param color The color values of the row
+ * @param xrays The precalculated (u - cx) / fx value of each column
+ * @param yray The precalculated (v - cy) / fy value of the row
+ * @param depthScale The scale factor that converts raw depth values into cloud units
+ * @param output The row of the cloud that we are writing to
+ * @param width The number of columns in the row
+ */
+template <typename T> void CloudUtils::BuildCloudRow(const T * depth, const uchar * color, const double * xrays, double yray, double depthScale, double * output, int width)
+{
+	for (auto column = 0; column < width; column++)
+	{
+		auto Z = (double)depth[column] * depthScale;
+		auto valid = Z != 0 ? 1.0 : 0.0;
+
+		output[column * 6 + 0] = xrays[column] * Z;
+		output[column * 6 + 1] = yray * Z;
+		output[column * 6 + 2] = Z;
+		output[column * 6 + 3] = color[column * 3 + 0] * valid;
+		output[column * 6 + 4] = color[column * 3 + 1] * valid;
+		output[column * 6 + 5] = color[column * 3 + 2] * valid;
 	}
+}
 
-	return result;
+/**
+ * Build a color cloud from a distorted camera. The undistorted ray of every pixel is retrieved from the shared 
+ * ray cache, so it is only found once for each camera.
+ * @param camera The camera matrix that we are working with
+ * @param distortion The distortion coefficients of the camera
+ * @param color The texture associated with the cloud (CV_8UC3)
+ * @param depth The depth associated with the cloud (CV_16U, CV_32F or CV_64F)
+ * @param output The output cloud (CV_64FC(6)), only reallocated if the size or type does not match
+ * @param depthScale The scale factor that converts raw depth values into cloud units
+ */
+void CloudUtils::BuildColorCloud(Mat& camera, Mat& distortion, Mat& color, Mat& depth, Mat& output, double depthScale)
+{
+	Mat rays = RayCache::GetDefault().GetRays(camera, distortion, depth.size());
+	BuildRayCloud(rays, color, depth, output, depthScale);
+}
+
+/**
+ * Build a color cloud from a table of per-pixel rays (see RayCache), which reduces each point to a multiply by the depth
+ * @param rays The ideal (X / Z, Y / Z) ray of each pixel (CV_64FC2)
+ * @param color The texture associated with the cloud (CV_8UC3)
+ * @param depth The depth associated with the cloud (CV_16U, CV_32F or CV_64F)
+ * @param output The output cloud (CV_64FC(6)), only reallocated if the size or type does not match
+ * @param depthScale The scale factor that converts raw depth values into cloud units
+ */
+void CloudUtils::BuildRayCloud(Mat& rays, Mat& color, Mat& depth, Mat& output, double depthScale)
+{
+	if (color.rows != depth.rows || color.cols != depth.cols) throw runtime_error("The color and depth images need to be the same size");
+	if (rays.rows != depth.rows || rays.cols != depth.cols || rays.type() != CV_64FC2) throw runtime_error("The rays are expected to be a CV_64FC2 table the size of the depth map");
+	if (color.type() != CV_8UC3) throw runtime_error("The color image is expected to be of type CV_8UC3");
+	if (depth.channels() != 1) throw runtime_error("The depth map can only have 1 channel");
+
+	auto depthType = depth.depth();
+	if (depthType != CV_16U && depthType != CV_32F && depthType != CV_64F) throw runtime_error("Unsupported depth map type: only CV_16U, CV_32F and CV_64F are supported");
+
+	output.create(color.size(), CV_64FC(6));
+
+	parallel_for_(cv::Range(0, color.rows), [&](const cv::Range& range)
+	{
+		for (auto row = range.start; row < range.end; row++)
+		{
+			auto rayRow = rays.ptr<Vec2d>(row);
+			auto colorRow = color.ptr<uchar>(row);
+			auto outputRow = output.ptr<double>(row);
+
+			switch (depthType)
+			{
+				case CV_16U: BuildRayCloudRow(depth.ptr<ushort>(row), colorRow, rayRow, depthScale, outputRow, color.cols); break;
+				case CV_32F: BuildRayCloudRow(depth.ptr<float>(row), colorRow, rayRow, depthScale, outputRow, color.cols); break;
+				default: BuildRayCloudRow(depth.ptr<double>(row), colorRow, rayRow, depthScale, outputRow, color.cols); break;
+			}
+		}
+	});
+}
+
+/**
+ * Build a single row of a color cloud from a row of rays (branch free, like BuildCloudRow)
+ * @param depth The depth values of the row
+ * @param color The color values of the row
+ * @param rays The rays of the row
+ * @param depthScale The scale factor that converts raw depth values into cloud units
+ * @param output The row of the cloud that we are writing to
+ * @param width The number of columns in the row
+ */
+template <typename T> void CloudUtils::BuildRayCloudRow(const T * depth, const uchar * color, const Vec2d * rays, double depthScale, double * output, int width)
+{
+	for (auto column = 0; column < width; column++)
+	{
+		auto Z = (double)depth[column] * depthScale;
+		auto valid = Z != 0 ? 1.0 : 0.0;
+
+		output[column * 6 + 0] = rays[column][0] * Z;
+		output[column * 6 + 1] = rays[column][1] * Z;
+		output[column * 6 + 2] = Z;
+		output[column * 6 + 3] = color[column * 3 + 0] * valid;
+		output[column * 6 + 4] = color[column * 3 + 1] * valid;
+		output[column * 6 + 5] = color[column * 3 + 2] * valid;
+	}
 }
 
 //--------------------------------------------------
@@ -99,52 +222,54 @@ Mat CloudUtils::SampleCloud(Mat& colorCloud, int step)
  */
 Mat CloudUtils::RenderImage(Mat& colorCloud, Mat & camera, Mat& pose, int step)
 {
-	Mat image = Mat::zeros(colorCloud.size(), CV_8UC3);
-	Mat depth = Mat_<double>::zeros(colorCloud.size());
+	// Fold the step scaling into the projection
+	auto projection = Math3D::GetProjection(camera, pose);
+	for (auto column = 0; column < 4; column++) { projection(0, column) /= step; projection(1, column) /= step; }
 
-	auto input = (double*)colorCloud.data;
-	auto depthData = (double*)depth.data;
+	Mat image, depth; RenderImage(colorCloud, projection, colorCloud.size(), image, depth);
+	return image;
+}
 
-	for (auto row = 0; row < image.rows; row++) 
+/**
+ * Render a color and depth image of the cloud using a parallel tile based z-buffer
+ * @param colorCloud The cloud that we are rendering
+ * @param projection The 3x4 projection matrix (see Math3D::GetProjection)
+ * @param imageSize The size of the image that we are rendering
+ * @param image The rendered color image (CV_8UC3)
+ * @param depth The rendered depth image (CV_32F, 0 where nothing was rendered)
+ * @param splatSize The width (in pixels) of the square that each point is drawn as
+ */
+void CloudUtils::RenderImage(Mat& colorCloud, const Matx34d& projection, const Size& imageSize, Mat& image, Mat& depth, int splatSize)
+{
+	auto points = vector<Vec3f>(colorCloud.total());
+	auto colors = vector<Vec3b>(colorCloud.total());
+	auto P = projection.val;
+
+	parallel_for_(cv::Range(0, colorCloud.rows), [&](const cv::Range& range)
 	{
-		for (auto column = 0; column < image.cols; column++) 
+		for (auto row = range.start; row < range.end; row++)
 		{
-			// Index of the row
-			auto index = column + row * image.cols;
-
-			// Retrieve the 3D points
-			auto X = input[index * 6 + 0];
-			auto Y = input[index * 6 + 1];
-			auto Z = input[index * 6 + 2];
-			if (Z == 0) continue;
-
-			// Retrieve the Color points
-			auto R = (int)input[index * 6 + 3];
-			auto G = (int)input[index * 6 + 4];
-			auto B = (int)input[index * 6 + 5];
+			auto input = colorCloud.ptr<double>(row);
 
-			// Determine the image location
-			auto tscene = Math3D::TransformPoint(pose, Point3d(X, Y, Z));
-			auto imagePoint = Math3D::Project(camera, tscene);
+			for (auto column = 0; column < colorCloud.cols; column++)
+			{
+				auto index = column + row * colorCloud.cols; auto point = input + column * 6;
+				if (point[2] == 0) { points[index] = Vec3f(); continue; }
 
-			// Get the index
-			auto u = (int)round(imagePoint.x / step); auto v = (int)round(imagePoint.y / step);
-			if (u < 0 || u >= colorCloud.cols || v < 0 || v >= colorCloud.rows) continue;
-			auto index2 = u + v * colorCloud.cols;
+				auto X = point[0]; auto Y = point[1]; auto Z = point[2];
+				auto w = P[8] * X + P[9] * Y + P[10] * Z + P[11];
+				auto u = (P[0] * X + P[1] * Y + P[2] * Z + P[3]) / w;
+				auto v = (P[4] * X + P[5] * Y + P[6] * Z + P[7]) / w;
 
-			// Determine whether we perform an update
-			auto currentZ = depthData[index2];
-			if (currentZ > 0 && currentZ < Z) continue;
-
-			// Perform updates
-			image.data[index2 * 3 + 0] = R;
-			image.data[index2 * 3 + 1] = G;
-			image.data[index2 * 3 + 2] = B;
-			depthData[index2] = Z;
+				points[index] = Vec3f((float)u, (float)v, (float)w);
+				colors[index] = Vec3b((uchar)point[3], (uchar)point[4], (uchar)point[5]);
+			}
 		}
-	}
+	});
 
-	return image;
+	auto ids = vector<int>(); Mat idImage;
+	auto renderer = TileRenderer(imageSize, splatSize);
+	renderer.Render(points, colors, ids, image, depth, idImage);
 }
 
 //--------------------------------------------------
@@ -188,6 +313,141 @@ Mat CloudUtils::ProjectImagePoints(Mat& camera, Mat& cloud)
 	return result;
 }
 
+/**
+ * @brief Transform and project the points of a cloud in a single pass, without building the transformed cloud
+ * @param camera The camera matrix of the camera that we are projecting into
+ * @param distortion The (k1, k2, p1, p2[, k3]) distortion parameters (may be empty)
+ * @param pose The 3x4 or 4x4 pose that maps cloud points into the frame of the camera
+ * @param cloud The CV_64FC(6) cloud that we are projecting
+ * @param imagePoints The resultant CV_32FC2 image points ((-1, -1) for invalid points or points behind the camera)
+ */
+void CloudUtils::ProjectImagePoints(Mat& camera, Mat& distortion, Mat& pose, Mat& cloud, Mat& imagePoints)
+{
+	ProjectImagePoints(camera, distortion, pose, cloud, imagePoints, nullptr);
+}
+
+/**
+ * @brief Transform and project the points of a cloud in a single pass, without building the transformed cloud
+ * @param camera The camera matrix of the camera that we are projecting into
+ * @param distortion The (k1, k2, p1, p2[, k3]) distortion parameters (may be empty)
+ * @param pose The 3x4 or 4x4 pose that maps cloud points into the frame of the camera
+ * @param cloud The CV_64FC(6) cloud that we are projecting
+ * @param imagePoints The resultant CV_32FC2 image points ((-1, -1) for invalid points or points behind the camera)
+ * @param depth The resultant CV_32F depth of each point in the frame of the camera (0 for invalid points)
+ */
+void CloudUtils::ProjectImagePoints(Mat& camera, Mat& distortion, Mat& pose, Mat& cloud, Mat& imagePoints, Mat& depth)
+{
+	ProjectImagePoints(camera, distortion, pose, cloud, imagePoints, &depth);
+}
+
+/**
+ * @brief Shared logic for the fused projection of a cloud
+ * @param camera The camera matrix of the camera that we are projecting into
+ * @param distortion The (k1, k2, p1, p2[, k3]) distortion parameters (may be empty)
+ * @param pose The 3x4 or 4x4 pose that maps cloud points into the frame of the camera
+ * @param cloud The CV_64FC(6) cloud that we are projecting
+ * @param imagePoints The resultant CV_32FC2 image points
+ * @param depth The resultant CV_32F depth image (nullptr if it is not needed)
+ */
+void CloudUtils::ProjectImagePoints(Mat& camera, Mat& distortion, Mat& pose, Mat& cloud, Mat& imagePoints, Mat * depth)
+{
+	if (cloud.type() != CV_64FC(6)) throw runtime_error("The cloud is expected to be of type CV_64FC(6)");
+	if (pose.type() != CV_64F || pose.total() < 12) throw runtime_error("The pose is expected to be a 3x4 or 4x4 CV_64F matrix");
+	if (distortion.total() > 5) throw runtime_error("Only the (k1, k2, p1, p2, k3) distortion model is supported");
+
+	// Copy the parameters into locals so that the inner loop does not go through the matrices
+	double P[12]; auto poseData = (double *)pose.data; for (auto i = 0; i < 12; i++) P[i] = poseData[i];
+	double K[9]; for (auto i = 0; i < 9; i++) K[i] = camera.at<double>(i / 3, i % 3);
+	double D[5] = { 0, 0, 0, 0, 0 }; Mat distortionParams; distortion.convertTo(distortionParams, CV_64F);
+	for (auto i = 0; i < (int)distortionParams.total(); i++) D[i] = ((double *)distortionParams.data)[i];
+	auto hasDistortion = D[0] != 0 || D[1] != 0 || D[2] != 0 || D[3] != 0 || D[4] != 0;
+
+	ProjectImagePoints(K, hasDistortion ? D : nullptr, P, cloud, imagePoints, depth);
+}
+
+/**
+ * @brief Transform and project the points of a cloud with a fixed size camera and pose (without distortion)
+ * @param camera The intrinsics of the camera that we are projecting into
+ * @param pose The pose that maps cloud points into the frame of the camera
+ * @param cloud The CV_64FC(6) cloud that we are projecting
+ * @param imagePoints The resultant CV_32FC2 image points ((-1, -1) for invalid points or points behind the camera)
+ * @param depth The resultant CV_32F depth of each point in the frame of the camera (0 for invalid points)
+ */
+void CloudUtils::ProjectImagePoints(const PinholeCamera& camera, const Pose3d& pose, Mat& cloud, Mat& imagePoints, Mat& depth)
+{
+	if (cloud.type() != CV_64FC(6)) throw runtime_error("The cloud is expected to be of type CV_64FC(6)");
+
+	double P[12]; pose.GetRows(P);
+	double K[] = { camera.GetFx(), 0, camera.GetCx(), 0, camera.GetFy(), camera.GetCy(), 0, 0, 1 };
+
+	ProjectImagePoints(K, nullptr, P, cloud, imagePoints, &depth);
+}
+
+/**
+ * @brief Project the rows of a cloud in parallel
+ * @param camera The 9 elements of the camera matrix (row major)
+ * @param distortion The 5 distortion parameters (nullptr if there is no distortion)
+ * @param pose The 12 elements of the pose (row major)
+ * @param cloud The CV_64FC(6) cloud that we are projecting
+ * @param imagePoints The resultant CV_32FC2 image points
+ * @param depth The resultant CV_32F depth image (nullptr if it is not needed)
+ */
+void CloudUtils::ProjectImagePoints(const double * camera, const double * distortion, const double * pose, Mat& cloud, Mat& imagePoints, Mat * depth)
+{
+	imagePoints.create(cloud.size(), CV_32FC2);
+	if (depth != nullptr) depth->create(cloud.size(), CV_32F);
+
+	parallel_for_(cv::Range(0, cloud.rows), [&](const cv::Range& range)
+	{
+		for (auto row = range.start; row < range.end; row++)
+		{
+			auto depthRow = depth == nullptr ? nullptr : depth->ptr<float>(row);
+			ProjectRow(cloud.ptr<double>(row), pose, camera, distortion, imagePoints.ptr<Vec2f>(row), depthRow, cloud.cols);
+		}
+	});
+}
+
+/**
+ * @brief Transform and project a row of cloud points
+ * @param input The row of CV_64FC(6) cloud points
+ * @param pose The 12 elements of the pose (row major)
+ * @param camera The 9 elements of the camera matrix (row major)
+ * @param distortion The 5 distortion parameters (nullptr if there is no distortion)
+ * @param imagePoints The resultant image points
+ * @param depth The resultant depth values (nullptr if not needed)
+ * @param width The number of points in the row
+ */
+void CloudUtils::ProjectRow(const double * input, const double * pose, const double * camera, const double * distortion, Vec2f * imagePoints, float * depth, int width)
+{
+	auto fx = camera[0]; auto skew = camera[1]; auto cx = camera[2]; auto fy = camera[4]; auto cy = camera[5];
+
+	for (auto column = 0; column < width; column++)
+	{
+		auto point = input + column * 6;
+		auto X = pose[0] * point[0] + pose[1] * point[1] + pose[2] * point[2] + pose[3];
+		auto Y = pose[4] * point[0] + pose[5] * point[1] + pose[6] * point[2] + pose[7];
+		auto Z = pose[8] * point[0] + pose[9] * point[1] + pose[10] * point[2] + pose[11];
+
+		auto valid = point[2] != 0 && Z > 0;
+		auto iz = valid ? 1.0 / Z : 0.0;
+		auto x = X * iz; auto y = Y * iz;
+
+		if (distortion != nullptr)
+		{
+			auto r2 = x * x + y * y;
+			auto radial = 1 + r2 * (distortion[0] + r2 * (distortion[1] + r2 * distortion[4]));
+			auto xd = x * radial + 2 * distortion[2] * x * y + distortion[3] * (r2 + 2 * x * x);
+			auto yd = y * radial + distortion[2] * (r2 + 2 * y * y) + 2 * distortion[3] * x * y;
+			x = xd; y = yd;
+		}
+
+		auto u = fx * x + skew * y + cx; auto v = fy * y + cy;
+
+		imagePoints[column] = valid ? Vec2f((float)u, (float)v) : Vec2f(-1, -1);
+		if (depth != nullptr) depth[column] = valid ? (float)Z : 0.0f;
+	}
+}
+
 //--------------------------------------------------
 // TransformCloud
 //--------------------------------------------------
@@ -199,42 +459,38 @@ Mat CloudUtils::ProjectImagePoints(Mat& camera, Mat& cloud)
  */
 Mat CloudUtils::TransformCloud(Mat& colorCloud, Mat& pose) 
 {
-	Mat result = Mat::zeros(colorCloud.size(), CV_64FC(6));
+	return TransformCloud(colorCloud, Pose3d::FromMat(pose));
+}
 
-	auto cloudData = (double*)colorCloud.data;
-	auto poseData = (double*)pose.data;
-	auto output = (double*)result.data;
+/**
+ * Transform the location of a point cloud with a fixed size pose. Invalid points (Z == 0) are left as zeros.
+ * @param colorCloud The CV_64FC(6) cloud that we are transforming
+ * @param pose The pose that we are transforming the cloud with
+ * @return Mat The transformed cloud
+ */
+Mat CloudUtils::TransformCloud(Mat& colorCloud, const Pose3d& pose)
+{
+	if (colorCloud.type() != CV_64FC(6)) throw runtime_error("The cloud is expected to be of type CV_64FC(6)");
 
-	for (auto row = 0; row < colorCloud.rows; row++)
+	Mat result = Mat::zeros(colorCloud.size(), CV_64FC(6));
+
+	parallel_for_(cv::Range(0, colorCloud.rows), [&](const cv::Range& range)
 	{
-		for (auto column = 0; column < colorCloud.cols; column++)
+		for (auto row = range.start; row < range.end; row++)
 		{
-			// Index of the row
-			auto index = column + row * colorCloud.cols;
+			auto input = colorCloud.ptr<double>(row); auto output = result.ptr<double>(row);
 
-			// Retrieve the 3D points
-			auto X = cloudData[index * 6 + 0];
-			auto Y = cloudData[index * 6 + 1];
-			auto Z = cloudData[index * 6 + 2];
-			if (Z == 0) continue;
-
-			// Retrieve the Color points
-			auto R = (int)cloudData[index * 6 + 3];
-			auto G = (int)cloudData[index * 6 + 4];
-			auto B = (int)cloudData[index * 6 + 5];
-
-			auto newX = poseData[0] * X + poseData[1] * Y + poseData[2] * Z + poseData[3];
-			auto newY = poseData[4] * X + poseData[5] * Y + poseData[6] * Z + poseData[7];
-			auto newZ = poseData[8] * X + poseData[9] * Y + poseData[10] * Z + poseData[11];
-
-			output[index * 6 + 0] = newX;
-			output[index * 6 + 1] = newY;
-			output[index * 6 + 2] = newZ;
-			output[index * 6 + 3] = R;
-			output[index * 6 + 4] = G;
-			output[index * 6 + 5] = B;
+			for (auto column = 0; column < colorCloud.cols; column++)
+			{
+				auto point = input + column * 6; auto target = output + column * 6;
+				if (point[2] == 0) continue;
+
+				auto location = pose.Apply(Point3d(point[0], point[1], point[2]));
+				target[0] = location.x; target[1] = location.y; target[2] = location.z;
+				target[3] = (int)point[3]; target[4] = (int)point[4]; target[5] = (int)point[5];
+			}
 		}
-	}
+	});
 
 	return result;
 }
@@ -250,23 +506,139 @@ Mat CloudUtils::TransformCloud(Mat& colorCloud, Mat& pose)
  */
 int CloudUtils::GetVertexCount(Mat& colorCloud) 
 {
-	auto cloudData = (double*)colorCloud.data;
-	auto counter = 0;
+	auto rowCounts = vector<int>(colorCloud.rows, 0);
 
-	for (auto row = 0; row < colorCloud.rows; row++)
+	parallel_for_(cv::Range(0, colorCloud.rows), [&](const cv::Range& range)
 	{
-		for (auto column = 0; column < colorCloud.cols; column++)
+		for (auto row = range.start; row < range.end; row++)
 		{
-			// Index of the row
-			auto index = column + row * colorCloud.cols;
+			auto input = colorCloud.ptr<double>(row);
+			for (auto column = 0; column < colorCloud.cols; column++) if (input[column * 6 + 2] != 0) rowCounts[row]++;
+		}
+	});
 
-			// Retrieve the 3D points
-			auto Z = cloudData[index * 6 + 2];
-			if (Z != 0) counter++;
+	auto counter = 0;
+	for (auto count : rowCounts) counter += count;
+	return counter;
+}
+
+//--------------------------------------------------
+// GetCloudBounds
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve the bounds of the valid points (Z != 0) within a color cloud, reducing the rows in parallel
+ * @param colorCloud The color cloud that we are examining
+ * @return Vec6d(xmin, xmax, ymin, ymax, zmin, zmax), or zeros if there are no valid points
+ */
+Vec6d CloudUtils::GetCloudBounds(Mat& colorCloud)
+{
+	auto rowBounds = vector<Vec6d>(colorCloud.rows, Vec6d(DBL_MAX, -DBL_MAX, DBL_MAX, -DBL_MAX, DBL_MAX, -DBL_MAX));
+
+	parallel_for_(cv::Range(0, colorCloud.rows), [&](const cv::Range& range)
+	{
+		for (auto row = range.start; row < range.end; row++)
+		{
+			auto input = colorCloud.ptr<double>(row); auto& bounds = rowBounds[row];
+
+			for (auto column = 0; column < colorCloud.cols; column++, input += 6)
+			{
+				if (input[2] == 0) continue;
+				bounds[0] = min(bounds[0], input[0]); bounds[1] = max(bounds[1], input[0]);
+				bounds[2] = min(bounds[2], input[1]); bounds[3] = max(bounds[3], input[1]);
+				bounds[4] = min(bounds[4], input[2]); bounds[5] = max(bounds[5], input[2]);
+			}
 		}
+	});
+
+	auto result = Vec6d(DBL_MAX, -DBL_MAX, DBL_MAX, -DBL_MAX, DBL_MAX, -DBL_MAX);
+	for (auto& bounds : rowBounds)
+	{
+		for (auto i = 0; i < 6; i += 2) { result[i] = min(result[i], bounds[i]); result[i + 1] = max(result[i + 1], bounds[i + 1]); }
 	}
 
-	return counter;
+	return result[0] > result[1] ? Vec6d() : result;
+}
+
+/**
+ * @brief Retrieve the bounds of the vertices of a model (cached by the model)
+ * @param model The model that we are examining
+ * @return Vec6d(xmin, xmax, ymin, ymax, zmin, zmax), or zeros if there are no vertices
+ */
+Vec6d CloudUtils::GetCloudBounds(Model * model)
+{
+	return model->GetBounds();
+}
+
+//--------------------------------------------------
+// CompactCloud
+//--------------------------------------------------
+
+/**
+ * Extract the valid (Z != 0) points of a color cloud into a dense cloud
+ * @param colorCloud The CV_64FC(6) cloud that we are compacting
+ * @return Mat A dense (valid count x 1) CV_64FC(6) cloud, in row major order
+ */
+Mat CloudUtils::CompactCloud(Mat& colorCloud) 
+{
+	Mat result, indices; CompactCloud(colorCloud, result, indices);
+	return result;
+}
+
+/**
+ * Extract the valid (Z != 0) points of a color cloud into a dense cloud, along with their pixel indices. 
+ * The valid points of each row stripe are counted in parallel, the counts are turned into offsets with a prefix sum 
+ * and then the stripes scatter their points in parallel.
+ * @param colorCloud The CV_64FC(6) cloud that we are compacting
+ * @param output A dense (valid count x 1) CV_64FC(6) cloud, in row major order
+ * @param indices A (valid count x 1) CV_32S map holding the pixel index (column + row * cols) of each point
+ */
+void CloudUtils::CompactCloud(Mat& colorCloud, Mat& output, Mat& indices) 
+{
+	if (colorCloud.type() != CV_64FC(6)) throw runtime_error("The color cloud is expected to be of type CV_64FC(6)");
+
+	auto stripeCount = max(1, min(colorCloud.rows, getNumThreads() * 4));
+	auto offsets = vector<int>(stripeCount + 1, 0);
+
+	parallel_for_(cv::Range(0, stripeCount), [&](const cv::Range& range)
+	{
+		for (auto stripe = range.start; stripe < range.end; stripe++)
+		{
+			for (auto row = colorCloud.rows * stripe / stripeCount; row < colorCloud.rows * (stripe + 1) / stripeCount; row++)
+			{
+				auto input = colorCloud.ptr<double>(row);
+				for (auto column = 0; column < colorCloud.cols; column++) if (input[column * 6 + 2] != 0) offsets[stripe + 1]++;
+			}
+		}
+	});
+
+	for (auto stripe = 0; stripe < stripeCount; stripe++) offsets[stripe + 1] += offsets[stripe];
+
+	output.create(offsets[stripeCount], 1, CV_64FC(6));
+	indices.create(offsets[stripeCount], 1, CV_32S);
+	auto points = (double *)output.data; auto pixels = (int *)indices.data;
+
+	parallel_for_(cv::Range(0, stripeCount), [&](const cv::Range& range)
+	{
+		for (auto stripe = range.start; stripe < range.end; stripe++)
+		{
+			auto position = offsets[stripe];
+
+			for (auto row = colorCloud.rows * stripe / stripeCount; row < colorCloud.rows * (stripe + 1) / stripeCount; row++)
+			{
+				auto input = colorCloud.ptr<double>(row);
+
+				for (auto column = 0; column < colorCloud.cols; column++)
+				{
+					auto point = input + column * 6;
+					if (point[2] == 0) continue;
+
+					memcpy(points + position * 6, point, 6 * sizeof(double));
+					pixels[position++] = column + row * colorCloud.cols;
+				}
+			}
+		}
+	});
 }
 
 //--------------------------------------------------
@@ -274,55 +646,126 @@ int CloudUtils::GetVertexCount(Mat& colorCloud)
 //--------------------------------------------------
 
 /**
- * Save the given color cloud to disk
+ * Save the given color cloud to disk as a PLY file
  * @param path The path that we are saving to
  * @param colorCloud The color cloud that we are saving
+ * @param binary Indicates whether a binary_little_endian file is written (otherwise ascii)
+ * @param doublePrecision Indicates whether locations are written as doubles (otherwise floats)
  */
-void CloudUtils::Save(const string& path, Mat& colorCloud) 
+void CloudUtils::Save(const string& path, Mat& colorCloud, bool binary, bool doublePrecision) 
 {
-	auto writer = ofstream(path);
-
-	auto vertexCount = GetVertexCount(colorCloud);
-
-	// Write the header
-	writer << "ply" << endl;
-	writer << "format ascii 1.0" << endl;
-	writer << "comment Generated by Neural Vision Ltd" << endl;
-	writer << "element vertex " << vertexCount << endl;
-	writer << "property float x" << endl;
-	writer << "property float y" << endl;
-	writer << "property float z" << endl;
-	writer << "property uchar red" << endl;
-	writer << "property uchar green" << endl;
-	writer << "property uchar blue" << endl;
-	writer << "end_header" << endl;
-
-	// Write the data
-	auto cloudData = (double*)colorCloud.data;
+	Mat normals; Save(path, colorCloud, normals, binary, doublePrecision);
+}
+
+/**
+ * Save the given color cloud, along with its normals, to disk as a PLY file
+ * @param path The path that we are saving to
+ * @param colorCloud The color cloud that we are saving
+ * @param normals A normal map (CV_32FC3 or CV_64FC3) of the same size as the cloud, or an empty Mat for no normals
+ * @param binary Indicates whether a binary_little_endian file is written (otherwise ascii)
+ * @param doublePrecision Indicates whether locations and normals are written as doubles (otherwise floats)
+ */
+void CloudUtils::Save(const string& path, Mat& colorCloud, Mat& normals, bool binary, bool doublePrecision) 
+{
+	auto hasNormals = !normals.empty();
+	if (hasNormals && (normals.rows != colorCloud.rows || normals.cols != colorCloud.cols)) throw runtime_error("The normal map needs to be the same size as the cloud");
+	if (hasNormals && normals.type() != CV_32FC3 && normals.type() != CV_64FC3) throw runtime_error("The normal map is expected to be of type CV_32FC3 or CV_64FC3");
+
+	auto writer = PlyWriter(path, binary, doublePrecision, hasNormals);
+
 	for (auto row = 0; row < colorCloud.rows; row++)
 	{
+		auto cloudRow = colorCloud.ptr<double>(row);
+
 		for (auto column = 0; column < colorCloud.cols; column++)
 		{
-			// Index of the row
-			auto index = column + row * colorCloud.cols;
+			auto point = cloudRow + column * 6;
+			if (point[2] == 0) continue;
 
-			// Retrieve the 3D points
-			auto X = cloudData[index * 6 + 0];
-			auto Y = cloudData[index * 6 + 1];
-			auto Z = cloudData[index * 6 + 2];
-			if (Z == 0) continue;
-
-			// Retrieve the Color points
-			auto R = (int)cloudData[index * 6 + 3];
-			auto G = (int)cloudData[index * 6 + 4];
-			auto B = (int)cloudData[index * 6 + 5];
-
-			// Write the PLY entry
-			char buffer[100];
-			sprintf(buffer, "%f %f %f %i %i %i\n", X, Y, Z, B, G, R);
-			writer.write(buffer, strlen(buffer));
+			// The cloud holds its color as (B, G, R)
+			auto location = Point3d(point[0], point[1], point[2]);
+			auto color = Vec3i((int)point[5], (int)point[4], (int)point[3]);
+
+			if (!hasNormals) { writer.AddVertex(location, color); continue; }
+
+			auto normal = normals.depth() == CV_32F ? Vec3d(normals.ptr<Vec3f>(row)[column]) : normals.ptr<Vec3d>(row)[column];
+			writer.AddVertex(location, normal, color);
 		}
 	}
 
-	writer.close();
+	writer.Close();
+}
+
+//--------------------------------------------------
+// ConvertCloud
+//--------------------------------------------------
+
+/**
+ * Convert a color cloud Mat into a compact point cloud. Points with Z == 0 are marked as invalid.
+ * @param colorCloud The CV_64FC(6) cloud that we are converting
+ * @param output The point cloud that we are writing to
+ */
+void CloudUtils::ConvertCloud(Mat& colorCloud, PointCloud& output)
+{
+	if (colorCloud.type() != CV_64FC(6)) throw runtime_error("The color cloud is expected to be of type CV_64FC(6)");
+
+	output.Resize(colorCloud.cols, colorCloud.rows);
+
+	auto width = colorCloud.cols; auto size = output.GetSize();
+	auto x = output.GetX().data(); auto y = output.GetY().data(); auto z = output.GetZ().data();
+	auto colors = output.GetColors().data(); auto validity = output.GetValidity().data();
+
+	// Each work item owns one 64-bit validity word, so no two threads write to the same word
+	parallel_for_(cv::Range(0, (int)output.GetValidity().size()), [&](const cv::Range& range)
+	{
+		for (auto word = range.start; word < range.end; word++)
+		{
+			auto start = word * 64; auto end = min(start + 64, size);
+			auto bits = (uint64_t)0;
+
+			for (auto index = start; index < end; index++)
+			{
+				auto point = colorCloud.ptr<double>(index / width) + (index % width) * 6;
+				if (point[2] == 0) continue;
+
+				x[index] = (float)point[0]; y[index] = (float)point[1]; z[index] = (float)point[2];
+				for (auto i = 0; i < 3; i++) colors[index * 3 + i] = saturate_cast<uchar>(point[3 + i]);
+				bits |= (uint64_t)1 << (index - start);
+			}
+
+			validity[word] = bits;
+		}
+	});
+
+	output.UpdateIndices();
+}
+
+/**
+ * Convert a compact point cloud back into a color cloud Mat. Invalid points are written as zeros.
+ * @param cloud The point cloud that we are converting
+ * @param output The CV_64FC(6) cloud that we are writing to
+ */
+void CloudUtils::ConvertCloud(PointCloud& cloud, Mat& output)
+{
+	output.create(cloud.GetHeight(), cloud.GetWidth(), CV_64FC(6));
+
+	parallel_for_(cv::Range(0, cloud.GetHeight()), [&](const cv::Range& range)
+	{
+		for (auto row = range.start; row < range.end; row++)
+		{
+			auto outputRow = output.ptr<double>(row);
+
+			for (auto column = 0; column < cloud.GetWidth(); column++)
+			{
+				auto index = column + row * cloud.GetWidth();
+				auto point = outputRow + column * 6;
+
+				if (!cloud.IsValid(index)) { for (auto i = 0; i < 6; i++) point[i] = 0; continue; }
+
+				auto location = cloud.GetLocation(index); auto color = cloud.GetColor(index);
+				point[0] = location.x; point[1] = location.y; point[2] = location.z;
+				point[3] = color[0]; point[4] = color[1]; point[5] = color[2];
+			}
+		}
+	});
 }
@@ -14,6 +14,11 @@ using namespace std;
 using namespace cv;
 
 #include "Math3D.h"
+#include "Model/Model.h"
+#include "Model/PointCloud.h"
+#include "Ply/PlyWriter.h"
+#include "Graphics/TileRenderer.h"
+#include "Camera/RayCache.h"
 
 namespace NVLib
 {
@@ -21,11 +26,32 @@ namespace NVLib
 	{
 	public:
 		static Mat BuildColorCloud(Mat & camera, Mat& color, Mat& depth);
+		static void BuildColorCloud(Mat& camera, Mat& color, Mat& depth, Mat& output, double depthScale = 1.0);
+		static void BuildColorCloud(Mat& camera, Mat& distortion, Mat& color, Mat& depth, Mat& output, double depthScale = 1.0);
+		static void BuildRayCloud(Mat& rays, Mat& color, Mat& depth, Mat& output, double depthScale = 1.0);
 		static Mat SampleCloud(Mat& colorCloud, int step = 1);
 		static Mat RenderImage(Mat& colorCloud, Mat& camera, Mat& pose, int step = 1);
+		static void RenderImage(Mat& colorCloud, const Matx34d& projection, const Size& imageSize, Mat& image, Mat& depth, int splatSize = 1);
 		static Mat TransformCloud(Mat& colorCloud, Mat& pose);
+		static Mat TransformCloud(Mat& colorCloud, const Pose3d& pose);
 		static Mat ProjectImagePoints(Mat& camera, Mat& cloud);
+		static void ProjectImagePoints(Mat& camera, Mat& distortion, Mat& pose, Mat& cloud, Mat& imagePoints);
+		static void ProjectImagePoints(Mat& camera, Mat& distortion, Mat& pose, Mat& cloud, Mat& imagePoints, Mat& depth);
+		static void ProjectImagePoints(const PinholeCamera& camera, const Pose3d& pose, Mat& cloud, Mat& imagePoints, Mat& depth);
 		static int GetVertexCount(Mat& colorCloud);
-		static void Save(const string& path, Mat& colorCloud);
+		static Vec6d GetCloudBounds(Mat& colorCloud);
+		static Vec6d GetCloudBounds(Model * model);
+		static Mat CompactCloud(Mat& colorCloud);
+		static void CompactCloud(Mat& colorCloud, Mat& output, Mat& indices);
+		static void Save(const string& path, Mat& colorCloud, bool binary = false, bool doublePrecision = false);
+		static void Save(const string& path, Mat& colorCloud, Mat& normals, bool binary = false, bool doublePrecision = false);
+		static void ConvertCloud(Mat& colorCloud, PointCloud& output);
+		static void ConvertCloud(PointCloud& cloud, Mat& output);
+	private:
+		static void ProjectImagePoints(Mat& camera, Mat& distortion, Mat& pose, Mat& cloud, Mat& imagePoints, Mat * depth);
+		static void ProjectImagePoints(const double * camera, const double * distortion, const double * pose, Mat& cloud, Mat& imagePoints, Mat * depth);
+		static void ProjectRow(const double * input, const double * pose, const double * camera, const double * distortion, Vec2f * imagePoints, float * depth, int width);
+		template <typename T> static void BuildCloudRow(const T * depth, const uchar * color, const double * xrays, double yray, double depthScale, double * output, int width);
+		template <typename T> static void BuildRayCloudRow(const T * depth, const uchar * color, const Vec2d * rays, double depthScale, double * output, int width);
 	};
 }
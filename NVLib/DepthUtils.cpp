@@ -0,0 +1,347 @@
+//--------------------------------------------------
+// Implementation code for DepthUtils
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "DepthUtils.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Bilateral Filter
+//--------------------------------------------------
+
+/**
+ * @brief Smooth a depth image with a separable bilateral filter. Missing (0) values are ignored and stay missing,
+ * and the depth weight stops the smoothing from crossing depth edges. The output may be the input image.
+ * @param depth The CV_16U or CV_32F depth image
+ * @param output The filtered depth image (same type as the input)
+ * @param radius The half width of the filter
+ * @param spaceSigma The standard deviation of the spatial weight (pixels)
+ * @param depthSigma The standard deviation of the depth weight (depth units)
+ */
+void DepthUtils::BilateralFilter(Mat& depth, Mat& output, int radius, double spaceSigma, double depthSigma)
+{
+	CheckDepth(depth);
+	if (radius <= 0 || spaceSigma <= 0 || depthSigma <= 0) throw runtime_error("The bilateral filter parameters must be positive");
+
+	if (depth.type() == CV_16U) BilateralFilter<ushort>(depth, output, radius, spaceSigma, depthSigma);
+	else BilateralFilter<float>(depth, output, radius, spaceSigma, depthSigma);
+}
+
+//--------------------------------------------------
+// Median Filter
+//--------------------------------------------------
+
+/**
+ * @brief Replace each valid depth value with the median of the valid values within a square window. Missing (0)
+ * values are excluded from the median and are not filled. The output may be the input image.
+ * @param depth The CV_16U or CV_32F depth image
+ * @param output The filtered depth image (same type as the input)
+ * @param radius The half width of the window
+ */
+void DepthUtils::MedianFilter(Mat& depth, Mat& output, int radius)
+{
+	CheckDepth(depth);
+	if (radius <= 0) throw runtime_error("The median filter radius must be positive");
+
+	if (depth.type() == CV_16U) MedianFilter<ushort>(depth, output, radius);
+	else MedianFilter<float>(depth, output, radius);
+}
+
+//--------------------------------------------------
+// Remove Flying Pixels
+//--------------------------------------------------
+
+/**
+ * @brief Remove the "flying pixels" that sensors produce between a foreground and a background surface. A pixel is
+ * removed if, along a row, column or diagonal through it, valid neighbours on both sides differ from it by more than
+ * (threshold x depth), so that the pixels on either side of a real edge are kept. The output may be the input image.
+ * @param depth The CV_16U or CV_32F depth image
+ * @param output The filtered depth image (same type as the input)
+ * @param threshold The largest allowed relative difference between neighbours (e.g. 0.05)
+ * @param radius The half width of the neighbourhood
+ */
+void DepthUtils::RemoveFlyingPixels(Mat& depth, Mat& output, double threshold, int radius)
+{
+	CheckDepth(depth);
+	if (radius <= 0 || threshold <= 0) throw runtime_error("The flying pixel parameters must be positive");
+
+	// Only a mask is built, so the removal itself can be applied in place
+	Mat mask = Mat_<uchar>(depth.size());
+	if (depth.type() == CV_16U) FindFlyingPixels<ushort>(depth, mask, threshold, radius);
+	else FindFlyingPixels<float>(depth, mask, threshold, radius);
+
+	if (output.data != depth.data) depth.copyTo(output);
+	output.setTo(0, mask);
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that a depth image is of a supported type
+ * @param depth The depth image that we are checking
+ */
+void DepthUtils::CheckDepth(Mat& depth)
+{
+	if (depth.type() != CV_16U && depth.type() != CV_32F) throw runtime_error("The depth image is expected to be of type CV_16U or CV_32F");
+}
+
+/**
+ * @brief Split the rows of an image into the stripes that are filtered in parallel
+ * @param rows The number of rows in the image
+ * @return The stripe boundaries, so that stripe i covers the rows [bounds[i], bounds[i + 1])
+ */
+vector<int> DepthUtils::GetStripes(int rows)
+{
+	auto count = max(1, min(rows, getNumThreads() * 4));
+	auto bounds = vector<int>(count + 1);
+	for (auto i = 0; i <= count; i++) bounds[i] = (int)((int64)rows * i / count);
+	return bounds;
+}
+
+/**
+ * @brief Apply the horizontal pass of the bilateral filter to a single row
+ * @param input The depth row
+ * @param output The filtered row
+ * @param width The number of values in the row
+ * @param radius The half width of the filter
+ * @param spaceWeights The spatial weight of each offset
+ * @param depthFactor The factor that converts a squared depth difference into the exponent of the depth weight
+ */
+template <typename T> void DepthUtils::BilateralRow(const T * input, float * output, int width, int radius, const vector<float>& spaceWeights, float depthFactor)
+{
+	for (auto column = 0; column < width; column++)
+	{
+		auto center = (float)input[column];
+		if (center == 0) { output[column] = 0; continue; }
+
+		auto total = 0.0f; auto weights = 0.0f;
+
+		for (auto offset = max(-radius, -column); offset <= min(radius, width - 1 - column); offset++)
+		{
+			auto value = (float)input[column + offset];
+			if (value == 0) continue;
+			auto delta = value - center;
+			auto weight = spaceWeights[abs(offset)] * exp(delta * delta * depthFactor);
+			total += weight * value; weights += weight;
+		}
+
+		output[column] = total / weights;
+	}
+}
+
+/**
+ * @brief Typed implementation of the bilateral filter. Each stripe of rows keeps a rolling window of 2 x radius + 1
+ * horizontally filtered rows, and the rows just outside each stripe are filtered before any output is written, so
+ * the output can share the input's memory without a full-frame intermediate.
+ * @param depth The depth image
+ * @param output The filtered depth image
+ * @param radius The half width of the filter
+ * @param spaceSigma The standard deviation of the spatial weight
+ * @param depthSigma The standard deviation of the depth weight
+ */
+template <typename T> void DepthUtils::BilateralFilter(Mat& depth, Mat& output, int radius, double spaceSigma, double depthSigma)
+{
+	auto spaceWeights = vector<float>(radius + 1);
+	for (auto i = 0; i <= radius; i++) spaceWeights[i] = (float)exp(-(i * i) / (2 * spaceSigma * spaceSigma));
+	auto depthFactor = (float)(-1.0 / (2 * depthSigma * depthSigma));
+
+	auto bounds = GetStripes(depth.rows); auto stripeCount = (int)bounds.size() - 1;
+	auto halos = vector<Mat>(stripeCount);
+
+	// The rows above and below a stripe belong to its neighbours, which may overwrite them once filtering starts
+	parallel_for_(cv::Range(0, stripeCount), [&](const cv::Range& range)
+	{
+		for (auto stripe = range.start; stripe < range.end; stripe++)
+		{
+			halos[stripe] = Mat_<float>(2 * radius, depth.cols);
+
+			for (auto i = 0; i < radius; i++)
+			{
+				auto above = bounds[stripe] - radius + i; auto below = bounds[stripe + 1] + i;
+				if (above >= 0) BilateralRow<T>(depth.ptr<T>(above), halos[stripe].ptr<float>(i), depth.cols, radius, spaceWeights, depthFactor);
+				if (below < depth.rows) BilateralRow<T>(depth.ptr<T>(below), halos[stripe].ptr<float>(radius + i), depth.cols, radius, spaceWeights, depthFactor);
+			}
+		}
+	});
+
+	output.create(depth.size(), depth.type());
+
+	parallel_for_(cv::Range(0, stripeCount), [&](const cv::Range& range)
+	{
+		auto size = 2 * radius + 1;
+		Mat horizontal = Mat_<float>(size, depth.cols);
+
+		for (auto stripe = range.start; stripe < range.end; stripe++)
+		{
+			auto start = bounds[stripe]; auto end = bounds[stripe + 1]; auto& halo = halos[stripe];
+
+			// Rows within the stripe have not been written yet when they enter the window
+			auto load = [&](int y)
+			{
+				auto target = horizontal.ptr<float>(y % size);
+				if (y < start) memcpy(target, halo.ptr<float>(y - start + radius), depth.cols * sizeof(float));
+				else if (y >= end) memcpy(target, halo.ptr<float>(radius + y - end), depth.cols * sizeof(float));
+				else BilateralRow<T>(depth.ptr<T>(y), target, depth.cols, radius, spaceWeights, depthFactor);
+			};
+
+			for (auto y = max(start - radius, 0); y < min(start + radius, depth.rows); y++) load(y);
+
+			for (auto row = start; row < end; row++)
+			{
+				if (row + radius < depth.rows) load(row + radius);
+
+				auto center = horizontal.ptr<float>(row % size); auto result = output.ptr<T>(row);
+
+				for (auto column = 0; column < depth.cols; column++)
+				{
+					if (center[column] == 0) { result[column] = 0; continue; }
+
+					auto total = 0.0f; auto weights = 0.0f;
+
+					for (auto offset = max(-radius, -row); offset <= min(radius, depth.rows - 1 - row); offset++)
+					{
+						auto value = horizontal.ptr<float>((row + offset) % size)[column];
+						if (value == 0) continue;
+						auto delta = value - center[column];
+						auto weight = spaceWeights[abs(offset)] * exp(delta * delta * depthFactor);
+						total += weight * value; weights += weight;
+					}
+
+					result[column] = saturate_cast<T>(total / weights);
+				}
+			}
+		}
+	});
+}
+
+/**
+ * @brief Typed implementation of the masked median filter. Each stripe of rows keeps a rolling window of the
+ * 2 x radius + 1 original rows, and the rows just outside each stripe are copied before any output is written, so
+ * the output can share the input's memory without a full-frame copy.
+ * @param depth The depth image
+ * @param output The filtered depth image
+ * @param radius The half width of the window
+ */
+template <typename T> void DepthUtils::MedianFilter(Mat& depth, Mat& output, int radius)
+{
+	auto bounds = GetStripes(depth.rows); auto stripeCount = (int)bounds.size() - 1;
+	auto halos = vector<Mat>(stripeCount);
+
+	// The rows above and below a stripe belong to its neighbours, which may overwrite them once filtering starts
+	parallel_for_(cv::Range(0, stripeCount), [&](const cv::Range& range)
+	{
+		for (auto stripe = range.start; stripe < range.end; stripe++)
+		{
+			halos[stripe] = Mat(2 * radius, depth.cols, depth.type());
+
+			for (auto i = 0; i < radius; i++)
+			{
+				auto above = bounds[stripe] - radius + i; auto below = bounds[stripe + 1] + i;
+				if (above >= 0) memcpy(halos[stripe].ptr<T>(i), depth.ptr<T>(above), depth.cols * sizeof(T));
+				if (below < depth.rows) memcpy(halos[stripe].ptr<T>(radius + i), depth.ptr<T>(below), depth.cols * sizeof(T));
+			}
+		}
+	});
+
+	output.create(depth.size(), depth.type());
+
+	parallel_for_(cv::Range(0, stripeCount), [&](const cv::Range& range)
+	{
+		auto size = 2 * radius + 1;
+		Mat input = Mat(size, depth.cols, depth.type());
+		auto values = vector<T>(); values.reserve(size * size);
+
+		for (auto stripe = range.start; stripe < range.end; stripe++)
+		{
+			auto start = bounds[stripe]; auto end = bounds[stripe + 1]; auto& halo = halos[stripe];
+
+			// Rows within the stripe have not been written yet when they enter the window
+			auto load = [&](int y)
+			{
+				auto source = y < start ? halo.ptr<T>(y - start + radius) : y >= end ? halo.ptr<T>(radius + y - end) : depth.ptr<T>(y);
+				memcpy(input.ptr<T>(y % size), source, depth.cols * sizeof(T));
+			};
+
+			for (auto y = max(start - radius, 0); y < min(start + radius, depth.rows); y++) load(y);
+
+			for (auto row = start; row < end; row++)
+			{
+				if (row + radius < depth.rows) load(row + radius);
+
+				auto result = output.ptr<T>(row);
+
+				for (auto column = 0; column < depth.cols; column++)
+				{
+					if (input.ptr<T>(row % size)[column] == 0) { result[column] = 0; continue; }
+
+					values.clear();
+					for (auto y = max(row - radius, 0); y <= min(row + radius, depth.rows - 1); y++)
+					{
+						auto window = input.ptr<T>(y % size);
+						for (auto x = max(column - radius, 0); x <= min(column + radius, depth.cols - 1); x++) if (window[x] != 0) values.push_back(window[x]);
+					}
+
+					auto middle = values.begin() + values.size() / 2;
+					nth_element(values.begin(), middle, values.end());
+					result[column] = *middle;
+				}
+			}
+		}
+	});
+}
+
+/**
+ * @brief Typed implementation of the flying pixel detection, which looks for discontinuities on opposing sides of a pixel
+ * @param depth The depth image
+ * @param mask The resultant mask (255 for the pixels that need to be removed)
+ * @param threshold The largest allowed relative difference between neighbours
+ * @param radius The half width of the neighbourhood
+ */
+template <typename T> void DepthUtils::FindFlyingPixels(Mat& depth, Mat& mask, double threshold, int radius)
+{
+	static const int DIRECTIONS[4][2] = { { 1, 0 }, { 0, 1 }, { 1, 1 }, { 1, -1 } };
+
+	parallel_for_(cv::Range(0, depth.rows), [&](const cv::Range& range)
+	{
+		for (auto row = range.start; row < range.end; row++)
+		{
+			auto input = depth.ptr<T>(row); auto result = mask.ptr<uchar>(row);
+
+			for (auto column = 0; column < depth.cols; column++)
+			{
+				result[column] = 0;
+				auto center = (double)input[column];
+				if (center == 0) continue;
+
+				auto limit = threshold * center;
+
+				// A pixel only flies if it is inconsistent with both sides of a line through it, so both sides of a real edge survive
+				for (auto direction = 0; direction < 4 && result[column] == 0; direction++)
+				{
+					auto dx = DIRECTIONS[direction][0]; auto dy = DIRECTIONS[direction][1];
+					auto inconsistent = 0;
+
+					for (auto side = -1; side <= 1; side += 2)
+					{
+						for (auto step = 1; step <= radius; step++)
+						{
+							auto x = column + side * step * dx; auto y = row + side * step * dy;
+							if (x < 0 || y < 0 || x >= depth.cols || y >= depth.rows) break;
+
+							auto value = (double)depth.ptr<T>(y)[x];
+							if (value != 0 && fabs(value - center) > limit) { inconsistent++; break; }
+						}
+					}
+
+					if (inconsistent == 2) result[column] = 255;
+				}
+			}
+		}
+	});
+}
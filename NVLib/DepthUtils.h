@@ -0,0 +1,34 @@
+//--------------------------------------------------
+// A set of utilities for filtering organized depth images
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+namespace NVLib
+{
+	class DepthUtils
+	{
+	public:
+		static void BilateralFilter(Mat& depth, Mat& output, int radius, double spaceSigma, double depthSigma);
+		static void MedianFilter(Mat& depth, Mat& output, int radius);
+		static void RemoveFlyingPixels(Mat& depth, Mat& output, double threshold, int radius = 1);
+	private:
+		static void CheckDepth(Mat& depth);
+		static vector<int> GetStripes(int rows);
+		template <typename T> static void BilateralRow(const T * input, float * output, int width, int radius, const vector<float>& spaceWeights, float depthFactor);
+		template <typename T> static void BilateralFilter(Mat& depth, Mat& output, int radius, double spaceSigma, double depthSigma);
+		template <typename T> static void MedianFilter(Mat& depth, Mat& output, int radius);
+		template <typename T> static void FindFlyingPixels(Mat& depth, Mat& mask, double threshold, int radius);
+	};
+}
@@ -156,14 +156,9 @@ Mat FeatureUtils::FindPose(Mat& camera, vector<Point3d>& scenePoints, vector<Poi
  */
 double FeatureUtils::FindPoseError(Mat& camera, Mat& pose, vector<Point3d>& scenePoints, vector<Point2d>& imagePoints) 
 {
-    auto estimated = vector<Point2d>(); 
-    for (auto i = 0; i < scenePoints.size(); i++) 
-    {
-        auto& scenePoint = scenePoints[i];
-        auto tpoint = Math3D::TransformPoint(pose, scenePoint);
-        auto imagePoint = Math3D::Project(camera, tpoint);
-        estimated.push_back(imagePoint);
-    }
+    auto transformed = vector<Point3d>(scenePoints.size()); auto estimated = vector<Point2d>(); 
+    if (!scenePoints.empty()) Math3D::TransformPoints(pose, &scenePoints[0], &transformed[0], scenePoints.size());
+    Math3D::ProjectPoints(camera, transformed, estimated);
 
     auto total = 0.0;
     for (auto i = 0; i < estimated.size(); i++) 
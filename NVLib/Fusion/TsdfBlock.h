@@ -0,0 +1,47 @@
+//--------------------------------------------------
+// Model: A dense block of truncated signed distance voxels
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+// The number of voxels along each side of a block
+#define TSDF_BLOCK_SIZE 8
+#define TSDF_BLOCK_VOXELS (TSDF_BLOCK_SIZE * TSDF_BLOCK_SIZE * TSDF_BLOCK_SIZE)
+
+namespace NVLib
+{
+	struct TsdfVoxel
+	{
+		float Distance = 1.0f;
+		float Weight = 0.0f;
+		float Blue = 0.0f;
+		float Green = 0.0f;
+		float Red = 0.0f;
+	};
+
+	struct TsdfBlock
+	{
+		Vec3i Position;
+		int LastFrame = -1;
+		TsdfVoxel Voxels[TSDF_BLOCK_VOXELS];
+
+		/**
+		 * @brief Retrieve the index of a voxel within the block
+		 * @param x The x coordinate within the block
+		 * @param y The y coordinate within the block
+		 * @param z The z coordinate within the block
+		 * @return int The resultant index
+		 */
+		static inline int GetIndex(int x, int y, int z) { return x + (y + z * TSDF_BLOCK_SIZE) * TSDF_BLOCK_SIZE; }
+	};
+}
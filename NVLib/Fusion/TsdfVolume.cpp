@@ -0,0 +1,348 @@
+//--------------------------------------------------
+// Implementation of class TsdfVolume
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "TsdfVolume.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param voxelSize The width of a voxel
+ * @param truncation The distance at which the signed distance is truncated (0 defaults to 4 voxels)
+ * @param maxWeight The maximum weight of a voxel (limits how slowly the volume adapts to change)
+ */
+TsdfVolume::TsdfVolume(double voxelSize, double truncation, float maxWeight) :
+	_voxelSize(voxelSize), _truncation(truncation), _maxWeight(maxWeight), _frameCount(0), _blockMap(4096)
+{
+	if (voxelSize <= 0) throw runtime_error("The voxel size must be positive");
+	if (_truncation <= 0) _truncation = 4 * voxelSize;
+}
+
+//--------------------------------------------------
+// Integrate
+//--------------------------------------------------
+
+/**
+ * @brief Fuse a depth frame into the volume
+ * @param frame The frame that we are fusing
+ * @param camera The camera matrix of the frame
+ * @param pose The 3x4 or 4x4 pose that maps volume (world) points into the frame of the camera
+ * @param depthScale The scale that converts the depth values into world units
+ */
+void TsdfVolume::Integrate(DepthFrame * frame, Mat& camera, Mat& pose, double depthScale)
+{
+	Integrate(frame->GetColor(), frame->GetDepth(), camera, pose, depthScale);
+}
+
+/**
+ * @brief Fuse a depth image (and its color) into the volume. The blocks that fall within the truncation band of
+ * the depth measurements are allocated, and then those blocks are updated in parallel.
+ * @param color The CV_8UC3 color image (may be empty)
+ * @param depth The CV_16U, CV_32F or CV_64F depth image (0 for missing values)
+ * @param camera The camera matrix of the frame
+ * @param pose The 3x4 or 4x4 pose that maps volume (world) points into the frame of the camera
+ * @param depthScale The scale that converts the depth values into world units
+ */
+void TsdfVolume::Integrate(Mat& color, Mat& depth, Mat& camera, Mat& pose, double depthScale)
+{
+	if (depth.type() != CV_16U && depth.type() != CV_32F && depth.type() != CV_64F) throw runtime_error("The depth image is expected to be of type CV_16U, CV_32F or CV_64F");
+	if (!color.empty() && (color.type() != CV_8UC3 || color.size() != depth.size())) throw runtime_error("The color image is expected to be CV_8UC3 and the same size as the depth image");
+
+	Mat depthImage; depth.convertTo(depthImage, CV_32F, depthScale);
+	auto P = GetPose(pose);
+
+	auto active = vector<int>(); AllocateBlocks(depthImage, camera, P, active);
+
+	parallel_for_(cv::Range(0, (int)active.size()), [&](const cv::Range& range)
+	{
+		for (auto i = range.start; i < range.end; i++) IntegrateBlock(_blocks[active[i]], color, depthImage, camera, P);
+	});
+
+	_frameCount++;
+}
+
+//--------------------------------------------------
+// Extract
+//--------------------------------------------------
+
+/**
+ * @brief Extract the surface (the zero crossings of the signed distance) as a cloud
+ * @return Mat A dense (point count x 1) CV_64FC(6) cloud
+ */
+Mat TsdfVolume::ExtractCloud()
+{
+	auto points = vector<Vec6d>(); ExtractPoints(points);
+
+	Mat result = Mat((int)points.size(), 1, CV_64FC(6));
+	if (!points.empty()) memcpy(result.data, points.data(), points.size() * sizeof(Vec6d));
+	return result;
+}
+
+/**
+ * @brief Extract the surface (the zero crossings of the signed distance) as a model
+ * @return Model* The resultant model
+ */
+Model * TsdfVolume::ExtractModel()
+{
+	auto points = vector<Vec6d>(); ExtractPoints(points);
+
+	auto result = new Model(); result->Reserve((int)points.size());
+	for (auto& point : points) result->AddVertex(Point3d(point[0], point[1], point[2]), Vec3i((int)round(point[3]), (int)round(point[4]), (int)round(point[5])));
+	return result;
+}
+
+/**
+ * @brief Remove all the blocks from the volume
+ */
+void TsdfVolume::Clear()
+{
+	_blockMap.Clear(); _blocks.clear(); _frameCount = 0;
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Allocate the blocks that fall within the truncation band of the depth measurements. Rows are
+ * processed in parallel stripes, each of which collects its own unique block keys. The keys are then
+ * merged into the block map in stripe order, so the block layout does not depend on the thread count.
+ * @param depth The CV_32F depth image (in world units)
+ * @param camera The camera matrix of the frame
+ * @param pose The pose that maps world points into the frame of the camera
+ * @param active The indices of the blocks that are touched by this frame
+ */
+void TsdfVolume::AllocateBlocks(Mat& depth, Mat& camera, const Matx44d& pose, vector<int>& active)
+{
+	auto inverse = Invert(pose);
+	auto fx = camera.at<double>(0, 0); auto fy = camera.at<double>(1, 1);
+	auto cx = camera.at<double>(0, 2); auto cy = camera.at<double>(1, 2);
+	auto blockWidth = _voxelSize * TSDF_BLOCK_SIZE; auto step = blockWidth * 0.5;
+
+	auto stripeCount = max(1, min(depth.rows, getNumThreads() * 4));
+	auto stripeKeys = vector<vector<uint64_t>>(stripeCount);
+
+	parallel_for_(cv::Range(0, stripeCount), [&](const cv::Range& range)
+	{
+		for (auto stripe = range.start; stripe < range.end; stripe++)
+		{
+			auto seen = VoxelHash<uchar>(1024); auto& keys = stripeKeys[stripe];
+
+			for (auto row = depth.rows * stripe / stripeCount; row < depth.rows * (stripe + 1) / stripeCount; row++)
+			{
+				auto input = depth.ptr<float>(row); auto yray = (row - cy) / fy;
+
+				for (auto column = 0; column < depth.cols; column++)
+				{
+					auto value = (double)input[column];
+					if (value <= 0) continue;
+
+					auto ray = Vec3d((column - cx) / fx, yray, 1.0);
+
+					for (auto distance = value - _truncation; distance < value + _truncation + step; distance += step)
+					{
+						auto world = inverse * Vec4d(ray[0] * distance, ray[1] * distance, distance, 1.0);
+						auto key = VoxelHash<int>::GetKey((int)floor(world[0] / blockWidth), (int)floor(world[1] / blockWidth), (int)floor(world[2] / blockWidth));
+						if (seen.Find(key) != nullptr) continue;
+						seen.Insert(key); keys.push_back(key);
+					}
+				}
+			}
+		}
+	});
+
+	for (auto& keys : stripeKeys)
+	{
+		for (auto key : keys)
+		{
+			auto& entry = _blockMap.Insert(key);
+
+			if (entry == 0)
+			{
+				_blocks.push_back(TsdfBlock()); _blocks.back().Position = VoxelHash<int>::GetCoordinates(key);
+				entry = (int)_blocks.size();
+			}
+
+			auto& block = _blocks[entry - 1];
+			if (block.LastFrame == _frameCount) continue;
+			block.LastFrame = _frameCount; active.push_back(entry - 1);
+		}
+	}
+}
+
+/**
+ * @brief Update the voxels of a block with a depth frame (projective signed distance along the optical axis)
+ * @param block The block that we are updating
+ * @param color The color image (may be empty)
+ * @param depth The CV_32F depth image (in world units)
+ * @param camera The camera matrix of the frame
+ * @param pose The pose that maps world points into the frame of the camera
+ */
+void TsdfVolume::IntegrateBlock(TsdfBlock& block, Mat& color, Mat& depth, Mat& camera, const Matx44d& pose)
+{
+	auto fx = camera.at<double>(0, 0); auto fy = camera.at<double>(1, 1);
+	auto cx = camera.at<double>(0, 2); auto cy = camera.at<double>(1, 2);
+	auto P = pose.val; auto origin = block.Position * TSDF_BLOCK_SIZE;
+
+	for (auto z = 0; z < TSDF_BLOCK_SIZE; z++)
+	{
+		for (auto y = 0; y < TSDF_BLOCK_SIZE; y++)
+		{
+			for (auto x = 0; x < TSDF_BLOCK_SIZE; x++)
+			{
+				auto wx = (origin[0] + x) * _voxelSize; auto wy = (origin[1] + y) * _voxelSize; auto wz = (origin[2] + z) * _voxelSize;
+
+				auto X = P[0] * wx + P[1] * wy + P[2] * wz + P[3];
+				auto Y = P[4] * wx + P[5] * wy + P[6] * wz + P[7];
+				auto Z = P[8] * wx + P[9] * wy + P[10] * wz + P[11];
+				if (Z <= 0) continue;
+
+				auto u = (int)round(fx * X / Z + cx); auto v = (int)round(fy * Y / Z + cy);
+				if (u < 0 || u >= depth.cols || v < 0 || v >= depth.rows) continue;
+
+				auto measured = (double)depth.at<float>(v, u);
+				if (measured <= 0) continue;
+
+				auto sdf = measured - Z;
+				if (sdf < -_truncation) continue;
+
+				auto& voxel = block.Voxels[TsdfBlock::GetIndex(x, y, z)];
+				auto weight = voxel.Weight + 1.0f;
+				voxel.Distance = (voxel.Distance * voxel.Weight + (float)min(1.0, sdf / _truncation)) / weight;
+
+				if (!color.empty())
+				{
+					auto& pixel = color.at<Vec3b>(v, u);
+					voxel.Blue = (voxel.Blue * voxel.Weight + pixel[0]) / weight;
+					voxel.Green = (voxel.Green * voxel.Weight + pixel[1]) / weight;
+					voxel.Red = (voxel.Red * voxel.Weight + pixel[2]) / weight;
+				}
+
+				voxel.Weight = min(weight, _maxWeight);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Find the zero crossings between each voxel and its +x, +y and +z neighbours. Blocks are processed
+ * in parallel stripes and the results are joined in block order.
+ * @param points The resultant (X, Y, Z, B, G, R) points
+ */
+void TsdfVolume::ExtractPoints(vector<Vec6d>& points)
+{
+	auto stripeCount = max(1, min((int)_blocks.size(), getNumThreads() * 4));
+	auto stripePoints = vector<vector<Vec6d>>(stripeCount);
+
+	parallel_for_(cv::Range(0, stripeCount), [&](const cv::Range& range)
+	{
+		for (auto stripe = range.start; stripe < range.end; stripe++)
+		{
+			auto first = (int)_blocks.size() * stripe / stripeCount;
+			auto last = (int)_blocks.size() * (stripe + 1) / stripeCount;
+
+			for (auto blockIndex = first; blockIndex < last; blockIndex++)
+			{
+				auto& block = _blocks[blockIndex]; auto origin = block.Position * TSDF_BLOCK_SIZE;
+
+				for (auto index = 0; index < TSDF_BLOCK_VOXELS; index++)
+				{
+					auto& voxel = block.Voxels[index];
+					if (voxel.Weight <= 0 || fabs(voxel.Distance) >= 1) continue;
+
+					auto x = index % TSDF_BLOCK_SIZE; auto y = (index / TSDF_BLOCK_SIZE) % TSDF_BLOCK_SIZE; auto z = index / (TSDF_BLOCK_SIZE * TSDF_BLOCK_SIZE);
+					auto position = Vec3i(origin[0] + x, origin[1] + y, origin[2] + z);
+
+					for (auto axis = 0; axis < 3; axis++)
+					{
+						auto offset = Vec3i(axis == 0, axis == 1, axis == 2);
+						auto local = Vec3i(x, y, z) + offset;
+						auto neighbour = local[axis] < TSDF_BLOCK_SIZE ? &block.Voxels[TsdfBlock::GetIndex(local[0], local[1], local[2])] : FindVoxel(position[0] + offset[0], position[1] + offset[1], position[2] + offset[2]);
+
+						if (neighbour == nullptr || neighbour->Weight <= 0 || fabs(neighbour->Distance) >= 1) continue;
+						if ((voxel.Distance < 0) == (neighbour->Distance < 0)) continue;
+
+						auto t = (double)voxel.Distance / (voxel.Distance - neighbour->Distance);
+						auto point = Vec6d();
+						for (auto i = 0; i < 3; i++) point[i] = (position[i] + t * offset[i]) * _voxelSize;
+						point[3] = voxel.Blue + t * (neighbour->Blue - voxel.Blue);
+						point[4] = voxel.Green + t * (neighbour->Green - voxel.Green);
+						point[5] = voxel.Red + t * (neighbour->Red - voxel.Red);
+						stripePoints[stripe].push_back(point);
+					}
+				}
+			}
+		}
+	});
+
+	points.clear();
+	for (auto& stripe : stripePoints) points.insert(points.end(), stripe.begin(), stripe.end());
+}
+
+/**
+ * @brief Find a voxel from its global coordinates
+ * @param x The x coordinate of the voxel
+ * @param y The y coordinate of the voxel
+ * @param z The z coordinate of the voxel
+ * @return TsdfVoxel* The voxel or nullptr if its block has not been allocated
+ */
+TsdfVoxel * TsdfVolume::FindVoxel(int x, int y, int z)
+{
+	auto bx = FloorDivide(x, TSDF_BLOCK_SIZE); auto by = FloorDivide(y, TSDF_BLOCK_SIZE); auto bz = FloorDivide(z, TSDF_BLOCK_SIZE);
+	auto entry = _blockMap.Find(VoxelHash<int>::GetKey(bx, by, bz));
+	if (entry == nullptr) return nullptr;
+
+	auto index = TsdfBlock::GetIndex(x - bx * TSDF_BLOCK_SIZE, y - by * TSDF_BLOCK_SIZE, z - bz * TSDF_BLOCK_SIZE);
+	return &_blocks[*entry - 1].Voxels[index];
+}
+
+/**
+ * @brief Convert a 3x4 or 4x4 pose into a 4x4 matrix
+ * @param pose The pose that we are converting
+ * @return Matx44d The resultant matrix
+ */
+Matx44d TsdfVolume::GetPose(Mat& pose)
+{
+	if (pose.type() != CV_64F || pose.total() < 12) throw runtime_error("The pose is expected to be a 3x4 or 4x4 CV_64F matrix");
+
+	auto result = Matx44d::eye(); auto data = (double *)pose.data;
+	for (auto i = 0; i < 12; i++) result.val[i] = data[i];
+	return result;
+}
+
+/**
+ * @brief Invert a rigid pose
+ * @param pose The pose that we are inverting
+ * @return Matx44d The inverted pose
+ */
+Matx44d TsdfVolume::Invert(const Matx44d& pose)
+{
+	auto result = Matx44d::eye();
+
+	for (auto row = 0; row < 3; row++)
+	{
+		for (auto column = 0; column < 3; column++) result(row, column) = pose(column, row);
+		result(row, 3) = -(pose(0, row) * pose(0, 3) + pose(1, row) * pose(1, 3) + pose(2, row) * pose(2, 3));
+	}
+
+	return result;
+}
+
+/**
+ * @brief Integer division that rounds towards negative infinity
+ * @param value The value that we are dividing
+ * @param divisor The (positive) divisor
+ * @return int The resultant quotient
+ */
+int TsdfVolume::FloorDivide(int value, int divisor)
+{
+	return value >= 0 ? value / divisor : -((-value + divisor - 1) / divisor);
+}
@@ -0,0 +1,58 @@
+//--------------------------------------------------
+// Fuses depth frames into a sparse truncated signed distance volume
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "../Model/Model.h"
+#include "../Model/DepthFrame.h"
+#include "../Spatial/VoxelHash.h"
+#include "TsdfBlock.h"
+
+namespace NVLib
+{
+	class TsdfVolume
+	{
+	private:
+		double _voxelSize;
+		double _truncation;
+		float _maxWeight;
+		int _frameCount;
+		VoxelHash<int> _blockMap;
+		vector<TsdfBlock> _blocks;
+	public:
+		TsdfVolume(double voxelSize, double truncation = 0, float maxWeight = 64);
+
+		void Integrate(DepthFrame * frame, Mat& camera, Mat& pose, double depthScale = 1.0);
+		void Integrate(Mat& color, Mat& depth, Mat& camera, Mat& pose, double depthScale = 1.0);
+
+		Mat ExtractCloud();
+		Model * ExtractModel();
+		void Clear();
+
+		inline double& GetVoxelSize() { return _voxelSize; }
+		inline double& GetTruncation() { return _truncation; }
+		inline float& GetMaxWeight() { return _maxWeight; }
+		inline int GetBlockCount() { return (int)_blocks.size(); }
+		inline vector<TsdfBlock>& GetBlocks() { return _blocks; }
+	private:
+		void AllocateBlocks(Mat& depth, Mat& camera, const Matx44d& pose, vector<int>& active);
+		void IntegrateBlock(TsdfBlock& block, Mat& color, Mat& depth, Mat& camera, const Matx44d& pose);
+		void ExtractPoints(vector<Vec6d>& points);
+		TsdfVoxel * FindVoxel(int x, int y, int z);
+		static Matx44d GetPose(Mat& pose);
+		static Matx44d Invert(const Matx44d& pose);
+		static int FloorDivide(int value, int divisor);
+	};
+}
@@ -0,0 +1,167 @@
+//--------------------------------------------------
+// Implementation of class SceneRenderer
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "SceneRenderer.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor. The projection buffers are kept between renders, so a renderer should be reused when 
+ * rendering many views (and not shared between threads).
+ * @param camera The 3x3 camera matrix
+ * @param imageSize The size of the images that we are rendering
+ * @param zmin The near clipping distance
+ * @param zmax The far clipping distance
+ * @param splatSize The width (in pixels) of the square that each point is drawn as
+ */
+SceneRenderer::SceneRenderer(Mat& camera, const Size& imageSize, double zmin, double zmax, int splatSize) :
+	_imageSize(imageSize), _zmin(zmin), _zmax(zmax), _renderer(imageSize, splatSize)
+{
+	if (camera.type() != CV_64F || camera.total() != 9) throw runtime_error("The camera matrix is expected to be a 3x3 CV_64F matrix");
+	_camera = camera.clone();
+}
+
+//--------------------------------------------------
+// Render
+//--------------------------------------------------
+
+/**
+ * @brief Render the scene, skipping the instances whose bounds fall outside the view
+ * @param scene The scene that we are rendering
+ * @param pose The 3x4 or 4x4 pose that maps world points into the frame of the camera
+ * @param image The rendered color image (CV_8UC3)
+ * @param depth The rendered depth image (CV_32F, 0 where nothing was rendered)
+ * @param idImage The rendered instance id image (CV_32S, -1 where nothing was rendered)
+ */
+void SceneRenderer::Render(Scene * scene, Mat& pose, Mat& image, Mat& depth, Mat& idImage)
+{
+	auto instances = vector<int>(); FindVisible(scene, pose, instances);
+	Render(scene, instances, pose, image, depth, idImage);
+}
+
+/**
+ * @brief Render the scene, using a hierarchy built over it to skip the instances outside the view
+ * @param scene The scene that we are rendering
+ * @param bvh The hierarchy built over the instances of the scene
+ * @param pose The 3x4 or 4x4 pose that maps world points into the frame of the camera
+ * @param image The rendered color image (CV_8UC3)
+ * @param depth The rendered depth image (CV_32F, 0 where nothing was rendered)
+ * @param idImage The rendered instance id image (CV_32S, -1 where nothing was rendered)
+ */
+void SceneRenderer::Render(Scene * scene, Bvh * bvh, Mat& pose, Mat& image, Mat& depth, Mat& idImage)
+{
+	auto frustum = Frustum(_camera, _imageSize, _zmin, _zmax, pose);
+	auto instances = vector<int>(); bvh->FindVisible(frustum, instances);
+	Render(scene, instances, pose, image, depth, idImage);
+}
+
+/**
+ * @brief Render a subset of the instances of a scene. The vertices of every instance are projected in parallel 
+ * and then resolved within a shared tile based z-buffer.
+ * @param scene The scene that we are rendering
+ * @param instances The instances that are being rendered
+ * @param pose The 3x4 or 4x4 pose that maps world points into the frame of the camera
+ * @param image The rendered color image (CV_8UC3)
+ * @param depth The rendered depth image (CV_32F, 0 where nothing was rendered)
+ * @param idImage The rendered instance id image (CV_32S, -1 where nothing was rendered)
+ */
+void SceneRenderer::Render(Scene * scene, const vector<int>& instances, Mat& pose, Mat& image, Mat& depth, Mat& idImage)
+{
+	if (pose.type() != CV_64F || pose.total() < 12) throw runtime_error("The pose is expected to be a 3x4 or 4x4 CV_64F matrix");
+
+	Project(scene, instances, pose);
+	_renderer.Render(_points, _colors, _ids, image, depth, idImage);
+	if (_ids.empty()) { idImage.create(_imageSize, CV_32SC1); idImage.setTo(-1); }
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Find the instances whose bounds overlap the view
+ * @param scene The scene that we are rendering
+ * @param pose The pose that maps world points into the frame of the camera
+ * @param instances The visible instances
+ */
+void SceneRenderer::FindVisible(Scene * scene, Mat& pose, vector<int>& instances)
+{
+	auto frustum = Frustum(_camera, _imageSize, _zmin, _zmax, pose);
+	frustum.FindVisible(scene, instances);
+}
+
+/**
+ * @brief Project the vertices of the instances into the buffers of the renderer. Vertices outside the clipping 
+ * distances are given a depth of 0, so that the renderer skips them.
+ * @param scene The scene that we are rendering
+ * @param instances The instances that are being projected
+ * @param pose The pose that maps world points into the frame of the camera
+ */
+void SceneRenderer::Project(Scene * scene, const vector<int>& instances, Mat& pose)
+{
+	// Find where each instance starts within the buffers
+	auto starts = vector<int>(instances.size() + 1, 0);
+	for (auto i = 0; i < (int)instances.size(); i++) starts[i + 1] = starts[i] + scene->GetInstanceModel(instances[i])->VertexCount();
+
+	auto total = starts.back();
+	_points.resize(total); _colors.resize(total); _ids.resize(total);
+	if (total == 0) return;
+
+	auto view = Math3D::GetProjection(_camera, pose);
+	auto stripeCount = max(1, min(total, getNumThreads() * 4));
+
+	parallel_for_(cv::Range(0, stripeCount), [&](const cv::Range& range)
+	{
+		for (auto stripe = range.start; stripe < range.end; stripe++)
+		{
+			auto first = (int)((int64)total * stripe / stripeCount);
+			auto last = (int)((int64)total * (stripe + 1) / stripeCount);
+
+			auto position = (int)(upper_bound(starts.begin(), starts.end(), first) - starts.begin()) - 1;
+
+			while (first < last)
+			{
+				auto instanceId = instances[position];
+				auto model = scene->GetInstanceModel(instanceId);
+				auto& T = scene->GetInstances()[instanceId].GetPose();
+
+				// Fold the instance pose into the projection
+				double P[12];
+				for (auto row = 0; row < 3; row++)
+				{
+					for (auto column = 0; column < 4; column++)
+					{
+						P[row * 4 + column] = view(row, 0) * T(0, column) + view(row, 1) * T(1, column) + view(row, 2) * T(2, column) + (column == 3 ? view(row, 3) : 0);
+					}
+				}
+
+				auto& x = model->GetX(); auto& y = model->GetY(); auto& z = model->GetZ(); auto& colors = model->GetColors();
+				auto end = min(last, starts[position + 1]);
+
+				for (auto index = first; index < end; index++)
+				{
+					auto vertex = index - starts[position];
+					auto X = x[vertex]; auto Y = y[vertex]; auto Z = z[vertex];
+
+					auto w = P[8] * X + P[9] * Y + P[10] * Z + P[11];
+					_colors[index] = colors[vertex]; _ids[index] = instanceId;
+					if (w < _zmin || w > _zmax) { _points[index] = Vec3f(); continue; }
+
+					auto u = (P[0] * X + P[1] * Y + P[2] * Z + P[3]) / w;
+					auto v = (P[4] * X + P[5] * Y + P[6] * Z + P[7]) / w;
+					_points[index] = Vec3f((float)u, (float)v, (float)w);
+				}
+
+				first = end; position++;
+			}
+		}
+	});
+}
@@ -0,0 +1,49 @@
+//--------------------------------------------------
+// Utility: Render the instances of a scene into color, depth and instance id images
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "../Math3D.h"
+#include "../Model/Scene.h"
+#include "../Spatial/Bvh.h"
+#include "TileRenderer.h"
+
+namespace NVLib
+{
+	class SceneRenderer
+	{
+	private:
+		Mat _camera;
+		Size _imageSize;
+		double _zmin;
+		double _zmax;
+		TileRenderer _renderer;
+		vector<Vec3f> _points;
+		vector<Vec3b> _colors;
+		vector<int> _ids;
+	public:
+		SceneRenderer(Mat& camera, const Size& imageSize, double zmin = 1e-2, double zmax = 1e3, int splatSize = 1);
+
+		void Render(Scene * scene, Mat& pose, Mat& image, Mat& depth, Mat& idImage);
+		void Render(Scene * scene, Bvh * bvh, Mat& pose, Mat& image, Mat& depth, Mat& idImage);
+		void Render(Scene * scene, const vector<int>& instances, Mat& pose, Mat& image, Mat& depth, Mat& idImage);
+
+		inline Mat& GetCamera() { return _camera; }
+		inline Size& GetImageSize() { return _imageSize; }
+	private:
+		void FindVisible(Scene * scene, Mat& pose, vector<int>& instances);
+		void Project(Scene * scene, const vector<int>& instances, Mat& pose);
+	};
+}
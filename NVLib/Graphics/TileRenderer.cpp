@@ -0,0 +1,213 @@
+//--------------------------------------------------
+// Implementation of class TileRenderer
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "TileRenderer.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param imageSize The size of the image that we are rendering
+ * @param splatSize The width (in pixels) of the square that each point is drawn as
+ * @param tileSize The width of the square screen tiles that depth is resolved in
+ */
+TileRenderer::TileRenderer(const Size& imageSize, int splatSize, int tileSize) : _imageSize(imageSize), _splatSize(max(splatSize, 1)), _tileSize(max(tileSize, 1))
+{
+	_tilesX = (imageSize.width + _tileSize - 1) / _tileSize;
+	_tilesY = (imageSize.height + _tileSize - 1) / _tileSize;
+}
+
+//--------------------------------------------------
+// Render
+//--------------------------------------------------
+
+/**
+ * @brief Render a set of projected points. Points are binned into screen tiles and then each tile resolves
+ * its own depth, so that no two threads write to the same pixel. Where points have the same depth, the
+ * point with the lowest index wins, so the result does not depend on the thread count.
+ * @param points The projected points as (u, v, depth), points with depth <= 0 are skipped
+ * @param colors The color of each point
+ * @param ids An optional id for each point (an empty vector means that the id image is not rendered)
+ * @param image The color image that is rendered (CV_8UC3)
+ * @param depth The depth image that is rendered (CV_32F, 0 where nothing was rendered)
+ * @param idImage The id image that is rendered (CV_32S, -1 where nothing was rendered)
+ */
+void TileRenderer::Render(const vector<Vec3f>& points, const vector<Vec3b>& colors, const vector<int>& ids, Mat& image, Mat& depth, Mat& idImage)
+{
+	if (colors.size() != points.size()) throw runtime_error("There needs to be a color for each point");
+	if (!ids.empty() && ids.size() != points.size()) throw runtime_error("There needs to be an id for each point");
+
+	image.create(_imageSize, CV_8UC3); depth.create(_imageSize, CV_32FC1);
+	if (!ids.empty()) idImage.create(_imageSize, CV_32SC1);
+
+	auto tileStarts = vector<int>(); auto tilePoints = vector<int>();
+	BinPoints(points, tileStarts, tilePoints);
+
+	parallel_for_(cv::Range(0, _tilesX * _tilesY), [&](const cv::Range& range)
+	{
+		for (auto tile = range.start; tile < range.end; tile++)
+		{
+			auto start = tileStarts[tile];
+			RenderTile(tile, points, colors, ids, tilePoints.data() + start, tileStarts[tile + 1] - start, image, depth, idImage);
+		}
+	});
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Find the pixels that a point covers
+ * @param point The projected point
+ * @param footprint The pixel rectangle covered by the point (clipped to the image)
+ * @return bool True if the point covers any pixels
+ */
+bool TileRenderer::GetFootprint(const Vec3f& point, Rect& footprint)
+{
+	if (!(point[2] > 0)) return false;
+
+	auto u = (int)round(point[0]) - (_splatSize - 1) / 2;
+	auto v = (int)round(point[1]) - (_splatSize - 1) / 2;
+
+	auto x1 = max(u, 0); auto x2 = min(u + _splatSize, _imageSize.width);
+	auto y1 = max(v, 0); auto y2 = min(v + _splatSize, _imageSize.height);
+	if (x1 >= x2 || y1 >= y2) return false;
+
+	footprint = Rect(x1, y1, x2 - x1, y2 - y1);
+	return true;
+}
+
+/**
+ * @brief Bin the points into the tiles that they overlap, using a parallel count, prefix sum and scatter.
+ * The points within each tile are kept in index order.
+ * @param points The projected points
+ * @param tileStarts The offset of each tile's list within tilePoints (tile count + 1 entries)
+ * @param tilePoints The concatenated point lists of the tiles
+ */
+void TileRenderer::BinPoints(const vector<Vec3f>& points, vector<int>& tileStarts, vector<int>& tilePoints)
+{
+	auto tileCount = _tilesX * _tilesY; auto pointCount = (int)points.size();
+	auto stripeCount = max(1, min(getNumThreads() * 4, pointCount / 4096 + 1));
+
+	// Count the number of points that each stripe adds to each tile
+	auto counts = vector<int>((size_t)stripeCount * tileCount, 0);
+
+	auto visit = [&](int stripe, auto action)
+	{
+		auto first = (int)((int64)pointCount * stripe / stripeCount);
+		auto last = (int)((int64)pointCount * (stripe + 1) / stripeCount);
+
+		for (auto i = first; i < last; i++)
+		{
+			auto footprint = Rect(); if (!GetFootprint(points[i], footprint)) continue;
+
+			auto tx1 = footprint.x / _tileSize; auto tx2 = (footprint.x + footprint.width - 1) / _tileSize;
+			auto ty1 = footprint.y / _tileSize; auto ty2 = (footprint.y + footprint.height - 1) / _tileSize;
+
+			for (auto ty = ty1; ty <= ty2; ty++) for (auto tx = tx1; tx <= tx2; tx++) action(tx + ty * _tilesX, i);
+		}
+	};
+
+	parallel_for_(cv::Range(0, stripeCount), [&](const cv::Range& range)
+	{
+		for (auto stripe = range.start; stripe < range.end; stripe++)
+		{
+			auto stripeCounts = &counts[(size_t)stripe * tileCount];
+			visit(stripe, [&](int tile, int) { stripeCounts[tile]++; });
+		}
+	});
+
+	// Prefix sum (tile major, stripe minor), so that each tile's list is in point order
+	tileStarts.assign(tileCount + 1, 0);
+	auto offsets = vector<int>((size_t)stripeCount * tileCount);
+	auto total = 0;
+
+	for (auto tile = 0; tile < tileCount; tile++)
+	{
+		tileStarts[tile] = total;
+		for (auto stripe = 0; stripe < stripeCount; stripe++)
+		{
+			offsets[(size_t)stripe * tileCount + tile] = total;
+			total += counts[(size_t)stripe * tileCount + tile];
+		}
+	}
+	tileStarts[tileCount] = total;
+
+	// Scatter the point indices into the tile lists
+	tilePoints.resize(total);
+
+	parallel_for_(cv::Range(0, stripeCount), [&](const cv::Range& range)
+	{
+		for (auto stripe = range.start; stripe < range.end; stripe++)
+		{
+			auto stripeOffsets = &offsets[(size_t)stripe * tileCount];
+			visit(stripe, [&](int tile, int index) { tilePoints[stripeOffsets[tile]++] = index; });
+		}
+	});
+}
+
+/**
+ * @brief Resolve the depth of a single tile and write it to the output images
+ * @param tile The index of the tile
+ * @param points The projected points
+ * @param colors The colors of the points
+ * @param ids The ids of the points (can be empty)
+ * @param tilePoints The indices of the points that overlap the tile (in point order)
+ * @param count The number of points that overlap the tile
+ * @param image The color image that is being rendered
+ * @param depth The depth image that is being rendered
+ * @param idImage The id image that is being rendered
+ */
+void TileRenderer::RenderTile(int tile, const vector<Vec3f>& points, const vector<Vec3b>& colors, const vector<int>& ids, const int * tilePoints, int count, Mat& image, Mat& depth, Mat& idImage)
+{
+	auto x0 = (tile % _tilesX) * _tileSize; auto y0 = (tile / _tilesX) * _tileSize;
+	auto width = min(_tileSize, _imageSize.width - x0); auto height = min(_tileSize, _imageSize.height - y0);
+
+	// The nearest point that covers each pixel of the tile
+	auto winners = vector<int>(width * height, -1);
+	auto depths = vector<float>(width * height, FLT_MAX);
+
+	for (auto i = 0; i < count; i++)
+	{
+		auto index = tilePoints[i]; auto& point = points[index];
+		auto footprint = Rect(); GetFootprint(point, footprint);
+
+		auto x1 = max(footprint.x, x0) - x0; auto x2 = min(footprint.x + footprint.width, x0 + width) - x0;
+		auto y1 = max(footprint.y, y0) - y0; auto y2 = min(footprint.y + footprint.height, y0 + height) - y0;
+
+		for (auto y = y1; y < y2; y++)
+		{
+			for (auto x = x1; x < x2; x++)
+			{
+				auto pixel = x + y * width;
+				if (point[2] >= depths[pixel]) continue;
+				depths[pixel] = point[2]; winners[pixel] = index;
+			}
+		}
+	}
+
+	for (auto y = 0; y < height; y++)
+	{
+		auto imageRow = image.ptr<Vec3b>(y0 + y) + x0;
+		auto depthRow = depth.ptr<float>(y0 + y) + x0;
+		auto idRow = ids.empty() ? nullptr : idImage.ptr<int>(y0 + y) + x0;
+
+		for (auto x = 0; x < width; x++)
+		{
+			auto winner = winners[x + y * width];
+
+			imageRow[x] = winner < 0 ? Vec3b() : colors[winner];
+			depthRow[x] = winner < 0 ? 0.0f : depths[x + y * width];
+			if (idRow != nullptr) idRow[x] = winner < 0 ? -1 : ids[winner];
+		}
+	}
+}
@@ -0,0 +1,41 @@
+//--------------------------------------------------
+// Utility: A tile based z-buffer renderer for projected points
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+namespace NVLib
+{
+	class TileRenderer
+	{
+	private:
+		Size _imageSize;
+		int _splatSize;
+		int _tileSize;
+		int _tilesX;
+		int _tilesY;
+	public:
+		TileRenderer(const Size& imageSize, int splatSize = 1, int tileSize = 32);
+
+		void Render(const vector<Vec3f>& points, const vector<Vec3b>& colors, const vector<int>& ids, Mat& image, Mat& depth, Mat& idImage);
+
+		inline Size& GetImageSize() { return _imageSize; }
+		inline int GetSplatSize() { return _splatSize; }
+		inline int GetTileSize() { return _tileSize; }
+	private:
+		bool GetFootprint(const Vec3f& point, Rect& footprint);
+		void BinPoints(const vector<Vec3f>& points, vector<int>& tileStarts, vector<int>& tilePoints);
+		void RenderTile(int tile, const vector<Vec3f>& points, const vector<Vec3b>& colors, const vector<int>& ids, const int * tilePoints, int count, Mat& image, Mat& depth, Mat& idImage);
+	};
+}
@@ -0,0 +1,334 @@
+//--------------------------------------------------
+// Utility: The Math3D kernels written once over a set of vector operations, and instantiated by each 
+// instruction set translation unit
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include "Math3DKernels.h"
+
+namespace NVLib
+{
+	// Internal linkage, so that the copies built with different instruction sets are never merged by the linker
+	namespace
+	{
+		/**
+		 * The operations of a single lane, used for the tails of the arrays
+		 */
+		template <typename T> struct ScalarOps
+		{
+			typedef T Scalar;
+			typedef T Vector;
+			static const size_t Width = 1;
+
+			static inline T Set(T value) { return value; }
+			static inline T Load(const T * input) { return *input; }
+			static inline void Store(T * output, T value) { *output = value; }
+			static inline T Add(T value1, T value2) { return value1 + value2; }
+			static inline T Sub(T value1, T value2) { return value1 - value2; }
+			static inline T Mul(T value1, T value2) { return value1 * value2; }
+			static inline T Div(T value1, T value2) { return value1 / value2; }
+			static inline T Min(T value1, T value2) { return value1 < value2 ? value1 : value2; }
+			static inline T Max(T value1, T value2) { return value1 > value2 ? value1 : value2; }
+			static inline void Load2(const T * input, T& a, T& b) { a = input[0]; b = input[1]; }
+			static inline void Load3(const T * input, T& a, T& b, T& c) { a = input[0]; b = input[1]; c = input[2]; }
+			static inline void Store2(T * output, T a, T b) { output[0] = a; output[1] = b; }
+			static inline void Store3(T * output, T a, T b, T c) { output[0] = a; output[1] = b; output[2] = c; }
+		};
+
+		/**
+		 * The kernels for a given set of vector operations. D works on doubles and F on floats.
+		 */
+		template <typename D, typename F> struct Math3DKernelSet
+		{
+			//--------------------------------------------------
+			// Project: u = fx * X / Z + cx, v = fy * Y / Z + cy
+			//--------------------------------------------------
+
+			template <typename V> static size_t ProjectBlock(const typename V::Scalar * K, const typename V::Scalar * x, const typename V::Scalar * y, const typename V::Scalar * z, typename V::Scalar * u, typename V::Scalar * v, size_t index, size_t count)
+			{
+				auto fx = V::Set(K[0]); auto fy = V::Set(K[1]); auto cx = V::Set(K[2]); auto cy = V::Set(K[3]);
+
+				for (; index + V::Width <= count; index += V::Width)
+				{
+					auto X = V::Load(x + index); auto Y = V::Load(y + index); auto Z = V::Load(z + index);
+					V::Store(u + index, V::Add(V::Div(V::Mul(fx, X), Z), cx));
+					V::Store(v + index, V::Add(V::Div(V::Mul(fy, Y), Z), cy));
+				}
+
+				return index;
+			}
+
+			template <typename V> static size_t ProjectBlockAoS(const double * K, const double * points, double * output, size_t index, size_t count)
+			{
+				auto fx = V::Set(K[0]); auto fy = V::Set(K[1]); auto cx = V::Set(K[2]); auto cy = V::Set(K[3]);
+
+				for (; index + V::Width <= count; index += V::Width)
+				{
+					typename V::Vector X, Y, Z; V::Load3(points + index * 3, X, Y, Z);
+					V::Store2(output + index * 2, V::Add(V::Div(V::Mul(fx, X), Z), cx), V::Add(V::Div(V::Mul(fy, Y), Z), cy));
+				}
+
+				return index;
+			}
+
+			static void Project64(const double * K, const double * x, const double * y, const double * z, double * u, double * v, size_t count)
+			{
+				auto index = ProjectBlock<D>(K, x, y, z, u, v, 0, count);
+				ProjectBlock<ScalarOps<double>>(K, x, y, z, u, v, index, count);
+			}
+
+			static void Project32(const float * K, const float * x, const float * y, const float * z, float * u, float * v, size_t count)
+			{
+				auto index = ProjectBlock<F>(K, x, y, z, u, v, 0, count);
+				ProjectBlock<ScalarOps<float>>(K, x, y, z, u, v, index, count);
+			}
+
+			static void ProjectAoS(const double * K, const double * points, double * output, size_t count)
+			{
+				auto index = ProjectBlockAoS<D>(K, points, output, 0, count);
+				ProjectBlockAoS<ScalarOps<double>>(K, points, output, index, count);
+			}
+
+			//--------------------------------------------------
+			// UnProject: X = (u - cx) * (Z / fx), Y = (v - cy) * (Z / fy)
+			//--------------------------------------------------
+
+			template <typename V> static size_t UnProjectBlock(const typename V::Scalar * K, const typename V::Scalar * u, const typename V::Scalar * v, const typename V::Scalar * depth, typename V::Scalar * x, typename V::Scalar * y, size_t index, size_t count)
+			{
+				auto fx = V::Set(K[0]); auto fy = V::Set(K[1]); auto cx = V::Set(K[2]); auto cy = V::Set(K[3]);
+
+				for (; index + V::Width <= count; index += V::Width)
+				{
+					auto U = V::Load(u + index); auto W = V::Load(v + index); auto Z = V::Load(depth + index);
+					V::Store(x + index, V::Mul(V::Sub(U, cx), V::Div(Z, fx)));
+					V::Store(y + index, V::Mul(V::Sub(W, cy), V::Div(Z, fy)));
+				}
+
+				return index;
+			}
+
+			template <typename V> static size_t UnProjectBlockAoS(const double * K, const double * points, const double * depth, double * output, size_t index, size_t count)
+			{
+				auto fx = V::Set(K[0]); auto fy = V::Set(K[1]); auto cx = V::Set(K[2]); auto cy = V::Set(K[3]);
+
+				for (; index + V::Width <= count; index += V::Width)
+				{
+					typename V::Vector U, W; V::Load2(points + index * 2, U, W); auto Z = V::Load(depth + index);
+					V::Store3(output + index * 3, V::Mul(V::Sub(U, cx), V::Div(Z, fx)), V::Mul(V::Sub(W, cy), V::Div(Z, fy)), Z);
+				}
+
+				return index;
+			}
+
+			static void UnProject64(const double * K, const double * u, const double * v, const double * depth, double * x, double * y, size_t count)
+			{
+				auto index = UnProjectBlock<D>(K, u, v, depth, x, y, 0, count);
+				UnProjectBlock<ScalarOps<double>>(K, u, v, depth, x, y, index, count);
+			}
+
+			static void UnProject32(const float * K, const float * u, const float * v, const float * depth, float * x, float * y, size_t count)
+			{
+				auto index = UnProjectBlock<F>(K, u, v, depth, x, y, 0, count);
+				UnProjectBlock<ScalarOps<float>>(K, u, v, depth, x, y, index, count);
+			}
+
+			static void UnProjectAoS(const double * K, const double * points, const double * depth, double * output, size_t count)
+			{
+				auto index = UnProjectBlockAoS<D>(K, points, depth, output, 0, count);
+				UnProjectBlockAoS<ScalarOps<double>>(K, points, depth, output, index, count);
+			}
+
+			//--------------------------------------------------
+			// Transform: X' = P0 * X + P1 * Y + P2 * Z + P3 (evaluated left to right)
+			//--------------------------------------------------
+
+			template <typename V> static inline typename V::Vector Row(const typename V::Vector * P, typename V::Vector X, typename V::Vector Y, typename V::Vector Z)
+			{
+				return V::Add(V::Add(V::Add(V::Mul(P[0], X), V::Mul(P[1], Y)), V::Mul(P[2], Z)), P[3]);
+			}
+
+			template <typename V> static size_t TransformBlock(const typename V::Scalar * pose, const typename V::Scalar * x, const typename V::Scalar * y, const typename V::Scalar * z, typename V::Scalar * ox, typename V::Scalar * oy, typename V::Scalar * oz, size_t index, size_t count)
+			{
+				typename V::Vector P[12]; for (auto i = 0; i < 12; i++) P[i] = V::Set(pose[i]);
+
+				for (; index + V::Width <= count; index += V::Width)
+				{
+					auto X = V::Load(x + index); auto Y = V::Load(y + index); auto Z = V::Load(z + index);
+					V::Store(ox + index, Row<V>(P, X, Y, Z));
+					V::Store(oy + index, Row<V>(P + 4, X, Y, Z));
+					V::Store(oz + index, Row<V>(P + 8, X, Y, Z));
+				}
+
+				return index;
+			}
+
+			template <typename V> static size_t TransformBlockAoS(const double * pose, const double * input, double * output, size_t index, size_t count)
+			{
+				typename V::Vector P[12]; for (auto i = 0; i < 12; i++) P[i] = V::Set(pose[i]);
+
+				for (; index + V::Width <= count; index += V::Width)
+				{
+					typename V::Vector X, Y, Z; V::Load3(input + index * 3, X, Y, Z);
+					V::Store3(output + index * 3, Row<V>(P, X, Y, Z), Row<V>(P + 4, X, Y, Z), Row<V>(P + 8, X, Y, Z));
+				}
+
+				return index;
+			}
+
+			static void Transform64(const double * P, const double * x, const double * y, const double * z, double * ox, double * oy, double * oz, size_t count)
+			{
+				auto index = TransformBlock<D>(P, x, y, z, ox, oy, oz, 0, count);
+				TransformBlock<ScalarOps<double>>(P, x, y, z, ox, oy, oz, index, count);
+			}
+
+			static void Transform32(const float * P, const float * x, const float * y, const float * z, float * ox, float * oy, float * oz, size_t count)
+			{
+				auto index = TransformBlock<F>(P, x, y, z, ox, oy, oz, 0, count);
+				TransformBlock<ScalarOps<float>>(P, x, y, z, ox, oy, oz, index, count);
+			}
+
+			static void TransformAoS(const double * P, const double * input, double * output, size_t count)
+			{
+				auto index = TransformBlockAoS<D>(P, input, output, 0, count);
+				TransformBlockAoS<ScalarOps<double>>(P, input, output, index, count);
+			}
+
+			//--------------------------------------------------
+			// Bounds: a min/max reduction per coordinate, with the lanes folded into the bounds at the end
+			//--------------------------------------------------
+
+			template <typename V> static void FoldBounds(typename V::Vector low, typename V::Vector high, double * bounds)
+			{
+				double lows[V::Width], highs[V::Width]; V::Store(lows, low); V::Store(highs, high);
+				for (size_t lane = 0; lane < V::Width; lane++) { bounds[0] = ScalarOps<double>::Min(bounds[0], lows[lane]); bounds[1] = ScalarOps<double>::Max(bounds[1], highs[lane]); }
+			}
+
+			template <typename V> static size_t BoundsBlock(const double * x, const double * y, const double * z, double * bounds, size_t index, size_t count)
+			{
+				if (index + V::Width > count) return index;
+
+				auto xmin = V::Set(bounds[0]), xmax = V::Set(bounds[1]), ymin = V::Set(bounds[2]), ymax = V::Set(bounds[3]), zmin = V::Set(bounds[4]), zmax = V::Set(bounds[5]);
+
+				for (; index + V::Width <= count; index += V::Width)
+				{
+					auto X = V::Load(x + index); auto Y = V::Load(y + index); auto Z = V::Load(z + index);
+					xmin = V::Min(xmin, X); xmax = V::Max(xmax, X);
+					ymin = V::Min(ymin, Y); ymax = V::Max(ymax, Y);
+					zmin = V::Min(zmin, Z); zmax = V::Max(zmax, Z);
+				}
+
+				FoldBounds<V>(xmin, xmax, bounds); FoldBounds<V>(ymin, ymax, bounds + 2); FoldBounds<V>(zmin, zmax, bounds + 4);
+
+				return index;
+			}
+
+			template <typename V> static size_t BoundsBlockAoS(const double * points, double * bounds, size_t index, size_t count)
+			{
+				if (index + V::Width > count) return index;
+
+				auto xmin = V::Set(bounds[0]), xmax = V::Set(bounds[1]), ymin = V::Set(bounds[2]), ymax = V::Set(bounds[3]), zmin = V::Set(bounds[4]), zmax = V::Set(bounds[5]);
+
+				for (; index + V::Width <= count; index += V::Width)
+				{
+					typename V::Vector X, Y, Z; V::Load3(points + index * 3, X, Y, Z);
+					xmin = V::Min(xmin, X); xmax = V::Max(xmax, X);
+					ymin = V::Min(ymin, Y); ymax = V::Max(ymax, Y);
+					zmin = V::Min(zmin, Z); zmax = V::Max(zmax, Z);
+				}
+
+				FoldBounds<V>(xmin, xmax, bounds); FoldBounds<V>(ymin, ymax, bounds + 2); FoldBounds<V>(zmin, zmax, bounds + 4);
+
+				return index;
+			}
+
+			static void Bounds64(const double * x, const double * y, const double * z, size_t count, double * bounds)
+			{
+				auto index = BoundsBlock<D>(x, y, z, bounds, 0, count);
+				BoundsBlock<ScalarOps<double>>(x, y, z, bounds, index, count);
+			}
+
+			static void BoundsAoS(const double * points, size_t count, double * bounds)
+			{
+				auto index = BoundsBlockAoS<D>(points, bounds, 0, count);
+				BoundsBlockAoS<ScalarOps<double>>(points, bounds, index, count);
+			}
+
+			//--------------------------------------------------
+			// Inside: the smallest signed distance to a set of planes, a * X + b * Y + c * Z + d (evaluated left to right)
+			//--------------------------------------------------
+
+			template <typename V> static inline typename V::Vector Nearest(const double * planes, size_t planeCount, typename V::Vector X, typename V::Vector Y, typename V::Vector Z)
+			{
+				typename V::Vector plane[4]; for (auto i = 0; i < 4; i++) plane[i] = V::Set(planes[i]);
+				auto result = Row<V>(plane, X, Y, Z);
+
+				for (size_t index = 1; index < planeCount; index++)
+				{
+					for (auto i = 0; i < 4; i++) plane[i] = V::Set(planes[index * 4 + i]);
+					result = V::Min(result, Row<V>(plane, X, Y, Z));
+				}
+
+				return result;
+			}
+
+			template <typename V> static inline void StoreMask(typename V::Vector distance, unsigned char * mask)
+			{
+				double distances[V::Width]; V::Store(distances, distance);
+				for (size_t lane = 0; lane < V::Width; lane++) mask[lane] = distances[lane] >= 0 ? 1 : 0;
+			}
+
+			template <typename V> static size_t InsideBlock(const double * planes, size_t planeCount, const double * x, const double * y, const double * z, unsigned char * mask, size_t index, size_t count)
+			{
+				for (; index + V::Width <= count; index += V::Width)
+				{
+					auto X = V::Load(x + index); auto Y = V::Load(y + index); auto Z = V::Load(z + index);
+					StoreMask<V>(Nearest<V>(planes, planeCount, X, Y, Z), mask + index);
+				}
+
+				return index;
+			}
+
+			template <typename V> static size_t InsideBlockAoS(const double * planes, size_t planeCount, const double * points, unsigned char * mask, size_t index, size_t count)
+			{
+				for (; index + V::Width <= count; index += V::Width)
+				{
+					typename V::Vector X, Y, Z; V::Load3(points + index * 3, X, Y, Z);
+					StoreMask<V>(Nearest<V>(planes, planeCount, X, Y, Z), mask + index);
+				}
+
+				return index;
+			}
+
+			static void Inside64(const double * planes, size_t planeCount, const double * x, const double * y, const double * z, size_t count, unsigned char * mask)
+			{
+				auto index = InsideBlock<D>(planes, planeCount, x, y, z, mask, 0, count);
+				InsideBlock<ScalarOps<double>>(planes, planeCount, x, y, z, mask, index, count);
+			}
+
+			static void InsideAoS(const double * planes, size_t planeCount, const double * points, size_t count, unsigned char * mask)
+			{
+				auto index = InsideBlockAoS<D>(planes, planeCount, points, mask, 0, count);
+				InsideBlockAoS<ScalarOps<double>>(planes, planeCount, points, mask, index, count);
+			}
+
+			//--------------------------------------------------
+			// Table
+			//--------------------------------------------------
+
+			static void Fill(Math3DKernelTable& table, const char * name)
+			{
+				table.Name = name;
+				table.ProjectAoS = ProjectAoS; table.Project64 = Project64; table.Project32 = Project32;
+				table.UnProjectAoS = UnProjectAoS; table.UnProject64 = UnProject64; table.UnProject32 = UnProject32;
+				table.TransformAoS = TransformAoS; table.Transform64 = Transform64; table.Transform32 = Transform32;
+				table.BoundsAoS = BoundsAoS; table.Bounds64 = Bounds64;
+				table.InsideAoS = InsideAoS; table.Inside64 = Inside64;
+			}
+		};
+	}
+}
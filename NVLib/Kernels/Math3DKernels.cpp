@@ -0,0 +1,53 @@
+//--------------------------------------------------
+// Implementation of class Math3DKernels (the scalar kernels and the runtime dispatch)
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "Math3DKernelSet.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Selection
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve the kernels of the widest instruction set that both the build and the processor support
+ * @return const Math3DKernelTable& The selected kernels (chosen once, on the first call)
+ */
+const Math3DKernelTable& Math3DKernels::Get()
+{
+	static const Math3DKernelTable table = []()
+	{
+		auto result = GetScalar();
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx512f") && GetAvx512(result)) return result;
+		if (__builtin_cpu_supports("avx2") && GetAvx2(result)) return result;
+		if (__builtin_cpu_supports("sse2") && GetSse2(result)) return result;
+#endif
+
+		return result;
+	}();
+
+	return table;
+}
+
+/**
+ * @brief Retrieve the scalar kernels, which every other version matches bit for bit
+ * @return const Math3DKernelTable& The scalar kernels
+ */
+const Math3DKernelTable& Math3DKernels::GetScalar()
+{
+	static const Math3DKernelTable table = []()
+	{
+		auto result = Math3DKernelTable();
+		Math3DKernelSet<ScalarOps<double>, ScalarOps<float>>::Fill(result, "Scalar");
+		return result;
+	}();
+
+	return table;
+}
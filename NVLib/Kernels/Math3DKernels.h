@@ -0,0 +1,51 @@
+//--------------------------------------------------
+// Utility: Batched kernels behind the Math3D point set operations, with a version per instruction set
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+using namespace std;
+
+namespace NVLib
+{
+	/**
+	 * The kernels of one instruction set. Camera parameters are (fx, fy, cx, cy) and poses are the first 3 rows of a 
+	 * 4x4 matrix (row major). Point arrays are either interleaved (AoS) or separate coordinate arrays (SoA). Every 
+	 * version performs the same operations in the same order, so the results are bit identical. Bounds are 
+	 * (xmin, xmax, ymin, ymax, zmin, zmax) and are widened by the points (so must be initialized by the caller). 
+	 * Planes are (a, b, c, d) and a point is inside when ax + by + cz + d >= 0 for every plane.
+	 */
+	struct Math3DKernelTable
+	{
+		const char * Name;
+		void (*ProjectAoS)(const double * K, const double * points, double * output, size_t count);
+		void (*Project64)(const double * K, const double * x, const double * y, const double * z, double * u, double * v, size_t count);
+		void (*Project32)(const float * K, const float * x, const float * y, const float * z, float * u, float * v, size_t count);
+		void (*UnProjectAoS)(const double * K, const double * points, const double * depth, double * output, size_t count);
+		void (*UnProject64)(const double * K, const double * u, const double * v, const double * depth, double * x, double * y, size_t count);
+		void (*UnProject32)(const float * K, const float * u, const float * v, const float * depth, float * x, float * y, size_t count);
+		void (*TransformAoS)(const double * P, const double * input, double * output, size_t count);
+		void (*Transform64)(const double * P, const double * x, const double * y, const double * z, double * ox, double * oy, double * oz, size_t count);
+		void (*Transform32)(const float * P, const float * x, const float * y, const float * z, float * ox, float * oy, float * oz, size_t count);
+		void (*BoundsAoS)(const double * points, size_t count, double * bounds);
+		void (*Bounds64)(const double * x, const double * y, const double * z, size_t count, double * bounds);
+		void (*InsideAoS)(const double * planes, size_t planeCount, const double * points, size_t count, unsigned char * mask);
+		void (*Inside64)(const double * planes, size_t planeCount, const double * x, const double * y, const double * z, size_t count, unsigned char * mask);
+	};
+
+	class Math3DKernels
+	{
+	public:
+		static const Math3DKernelTable& Get();
+		static const Math3DKernelTable& GetScalar();
+
+		static bool GetSse2(Math3DKernelTable& table);
+		static bool GetAvx2(Math3DKernelTable& table);
+		static bool GetAvx512(Math3DKernelTable& table);
+	};
+}
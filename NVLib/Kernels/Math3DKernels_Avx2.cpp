@@ -0,0 +1,99 @@
+//--------------------------------------------------
+// Implementation of the AVX2 Math3D kernels (built with -mavx2)
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "Math3DKernelSet.h"
+using namespace NVLib;
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+namespace
+{
+	struct DoubleOps
+	{
+		typedef double Scalar;
+		typedef __m256d Vector;
+		static const size_t Width = 4;
+
+		static inline Vector Set(double value) { return _mm256_set1_pd(value); }
+		static inline Vector Load(const double * input) { return _mm256_loadu_pd(input); }
+		static inline void Store(double * output, Vector value) { _mm256_storeu_pd(output, value); }
+		static inline Vector Add(Vector value1, Vector value2) { return _mm256_add_pd(value1, value2); }
+		static inline Vector Sub(Vector value1, Vector value2) { return _mm256_sub_pd(value1, value2); }
+		static inline Vector Mul(Vector value1, Vector value2) { return _mm256_mul_pd(value1, value2); }
+		static inline Vector Div(Vector value1, Vector value2) { return _mm256_div_pd(value1, value2); }
+		static inline Vector Min(Vector value1, Vector value2) { return _mm256_min_pd(value1, value2); }
+		static inline Vector Max(Vector value1, Vector value2) { return _mm256_max_pd(value1, value2); }
+
+		static inline void Load2(const double * input, Vector& a, Vector& b)
+		{
+			auto index = _mm256_set_epi64x(6, 4, 2, 0);
+			a = _mm256_i64gather_pd(input, index, 8); b = _mm256_i64gather_pd(input + 1, index, 8);
+		}
+
+		static inline void Load3(const double * input, Vector& a, Vector& b, Vector& c)
+		{
+			auto index = _mm256_set_epi64x(9, 6, 3, 0);
+			a = _mm256_i64gather_pd(input, index, 8); b = _mm256_i64gather_pd(input + 1, index, 8); c = _mm256_i64gather_pd(input + 2, index, 8);
+		}
+
+		static inline void Store2(double * output, Vector a, Vector b)
+		{
+			auto low = _mm256_unpacklo_pd(a, b); auto high = _mm256_unpackhi_pd(a, b);
+			_mm256_storeu_pd(output, _mm256_permute2f128_pd(low, high, 0x20)); _mm256_storeu_pd(output + 4, _mm256_permute2f128_pd(low, high, 0x31));
+		}
+
+		static inline void Store3(double * output, Vector a, Vector b, Vector c)
+		{
+			alignas(32) double values[12];
+			_mm256_store_pd(values, a); _mm256_store_pd(values + 4, b); _mm256_store_pd(values + 8, c);
+			for (auto i = 0; i < 4; i++) { output[i * 3] = values[i]; output[i * 3 + 1] = values[4 + i]; output[i * 3 + 2] = values[8 + i]; }
+		}
+	};
+
+	struct FloatOps
+	{
+		typedef float Scalar;
+		typedef __m256 Vector;
+		static const size_t Width = 8;
+
+		static inline Vector Set(float value) { return _mm256_set1_ps(value); }
+		static inline Vector Load(const float * input) { return _mm256_loadu_ps(input); }
+		static inline void Store(float * output, Vector value) { _mm256_storeu_ps(output, value); }
+		static inline Vector Add(Vector value1, Vector value2) { return _mm256_add_ps(value1, value2); }
+		static inline Vector Sub(Vector value1, Vector value2) { return _mm256_sub_ps(value1, value2); }
+		static inline Vector Mul(Vector value1, Vector value2) { return _mm256_mul_ps(value1, value2); }
+		static inline Vector Div(Vector value1, Vector value2) { return _mm256_div_ps(value1, value2); }
+	};
+}
+
+/**
+ * @brief Retrieve the AVX2 kernels
+ * @param table The table that the kernels are written to
+ * @return bool True, as the kernels were built
+ */
+bool Math3DKernels::GetAvx2(Math3DKernelTable& table)
+{
+	Math3DKernelSet<DoubleOps, FloatOps>::Fill(table, "AVX2");
+	return true;
+}
+
+#else
+
+/**
+ * @brief The AVX2 kernels are not available within this build
+ * @param table The table that the kernels would be written to
+ * @return bool False, as the kernels were not built
+ */
+bool Math3DKernels::GetAvx2(Math3DKernelTable& table)
+{
+	return false;
+}
+
+#endif
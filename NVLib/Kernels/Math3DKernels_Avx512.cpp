@@ -0,0 +1,100 @@
+//--------------------------------------------------
+// Implementation of the AVX-512 Math3D kernels (built with -mavx512f)
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "Math3DKernelSet.h"
+using namespace NVLib;
+
+#if defined(__AVX512F__)
+
+#include <immintrin.h>
+
+namespace
+{
+	struct DoubleOps
+	{
+		typedef double Scalar;
+		typedef __m512d Vector;
+		static const size_t Width = 8;
+
+		static inline Vector Set(double value) { return _mm512_set1_pd(value); }
+		static inline Vector Load(const double * input) { return _mm512_loadu_pd(input); }
+		static inline void Store(double * output, Vector value) { _mm512_storeu_pd(output, value); }
+		static inline Vector Add(Vector value1, Vector value2) { return _mm512_add_pd(value1, value2); }
+		static inline Vector Sub(Vector value1, Vector value2) { return _mm512_sub_pd(value1, value2); }
+		static inline Vector Mul(Vector value1, Vector value2) { return _mm512_mul_pd(value1, value2); }
+		static inline Vector Div(Vector value1, Vector value2) { return _mm512_div_pd(value1, value2); }
+		static inline Vector Min(Vector value1, Vector value2) { return _mm512_mask_min_pd(value1, 0xFF, value1, value2); }
+		static inline Vector Max(Vector value1, Vector value2) { return _mm512_mask_max_pd(value1, 0xFF, value1, value2); }
+
+		static inline Vector Gather(__m512i index, const double * input) { return _mm512_mask_i64gather_pd(_mm512_setzero_pd(), 0xFF, index, input, 8); }
+
+		static inline void Load2(const double * input, Vector& a, Vector& b)
+		{
+			auto index = _mm512_set_epi64(14, 12, 10, 8, 6, 4, 2, 0);
+			a = Gather(index, input); b = Gather(index, input + 1);
+		}
+
+		static inline void Load3(const double * input, Vector& a, Vector& b, Vector& c)
+		{
+			auto index = _mm512_set_epi64(21, 18, 15, 12, 9, 6, 3, 0);
+			a = Gather(index, input); b = Gather(index, input + 1); c = Gather(index, input + 2);
+		}
+
+		static inline void Store2(double * output, Vector a, Vector b)
+		{
+			auto index = _mm512_set_epi64(14, 12, 10, 8, 6, 4, 2, 0);
+			_mm512_i64scatter_pd(output, index, a, 8); _mm512_i64scatter_pd(output + 1, index, b, 8);
+		}
+
+		static inline void Store3(double * output, Vector a, Vector b, Vector c)
+		{
+			auto index = _mm512_set_epi64(21, 18, 15, 12, 9, 6, 3, 0);
+			_mm512_i64scatter_pd(output, index, a, 8); _mm512_i64scatter_pd(output + 1, index, b, 8); _mm512_i64scatter_pd(output + 2, index, c, 8);
+		}
+	};
+
+	struct FloatOps
+	{
+		typedef float Scalar;
+		typedef __m512 Vector;
+		static const size_t Width = 16;
+
+		static inline Vector Set(float value) { return _mm512_set1_ps(value); }
+		static inline Vector Load(const float * input) { return _mm512_loadu_ps(input); }
+		static inline void Store(float * output, Vector value) { _mm512_storeu_ps(output, value); }
+		static inline Vector Add(Vector value1, Vector value2) { return _mm512_add_ps(value1, value2); }
+		static inline Vector Sub(Vector value1, Vector value2) { return _mm512_sub_ps(value1, value2); }
+		static inline Vector Mul(Vector value1, Vector value2) { return _mm512_mul_ps(value1, value2); }
+		static inline Vector Div(Vector value1, Vector value2) { return _mm512_div_ps(value1, value2); }
+	};
+}
+
+/**
+ * @brief Retrieve the AVX-512 kernels
+ * @param table The table that the kernels are written to
+ * @return bool True, as the kernels were built
+ */
+bool Math3DKernels::GetAvx512(Math3DKernelTable& table)
+{
+	Math3DKernelSet<DoubleOps, FloatOps>::Fill(table, "AVX512");
+	return true;
+}
+
+#else
+
+/**
+ * @brief The AVX-512 kernels are not available within this build
+ * @param table The table that the kernels would be written to
+ * @return bool False, as the kernels were not built
+ */
+bool Math3DKernels::GetAvx512(Math3DKernelTable& table)
+{
+	return false;
+}
+
+#endif
@@ -0,0 +1,96 @@
+//--------------------------------------------------
+// Implementation of the SSE2 Math3D kernels (built with -msse2)
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "Math3DKernelSet.h"
+using namespace NVLib;
+
+#if defined(__SSE2__)
+
+#include <emmintrin.h>
+
+namespace
+{
+	struct DoubleOps
+	{
+		typedef double Scalar;
+		typedef __m128d Vector;
+		static const size_t Width = 2;
+
+		static inline Vector Set(double value) { return _mm_set1_pd(value); }
+		static inline Vector Load(const double * input) { return _mm_loadu_pd(input); }
+		static inline void Store(double * output, Vector value) { _mm_storeu_pd(output, value); }
+		static inline Vector Add(Vector value1, Vector value2) { return _mm_add_pd(value1, value2); }
+		static inline Vector Sub(Vector value1, Vector value2) { return _mm_sub_pd(value1, value2); }
+		static inline Vector Mul(Vector value1, Vector value2) { return _mm_mul_pd(value1, value2); }
+		static inline Vector Div(Vector value1, Vector value2) { return _mm_div_pd(value1, value2); }
+		static inline Vector Min(Vector value1, Vector value2) { return _mm_min_pd(value1, value2); }
+		static inline Vector Max(Vector value1, Vector value2) { return _mm_max_pd(value1, value2); }
+
+		static inline void Load2(const double * input, Vector& a, Vector& b)
+		{
+			auto p0 = _mm_loadu_pd(input); auto p1 = _mm_loadu_pd(input + 2);
+			a = _mm_unpacklo_pd(p0, p1); b = _mm_unpackhi_pd(p0, p1);
+		}
+
+		static inline void Load3(const double * input, Vector& a, Vector& b, Vector& c)
+		{
+			auto v0 = _mm_loadu_pd(input); auto v1 = _mm_loadu_pd(input + 2); auto v2 = _mm_loadu_pd(input + 4);
+			a = _mm_shuffle_pd(v0, v1, 2); b = _mm_shuffle_pd(v0, v2, 1); c = _mm_shuffle_pd(v1, v2, 2);
+		}
+
+		static inline void Store2(double * output, Vector a, Vector b)
+		{
+			_mm_storeu_pd(output, _mm_unpacklo_pd(a, b)); _mm_storeu_pd(output + 2, _mm_unpackhi_pd(a, b));
+		}
+
+		static inline void Store3(double * output, Vector a, Vector b, Vector c)
+		{
+			_mm_storeu_pd(output, _mm_unpacklo_pd(a, b)); _mm_storeu_pd(output + 2, _mm_shuffle_pd(c, a, 2)); _mm_storeu_pd(output + 4, _mm_unpackhi_pd(b, c));
+		}
+	};
+
+	struct FloatOps
+	{
+		typedef float Scalar;
+		typedef __m128 Vector;
+		static const size_t Width = 4;
+
+		static inline Vector Set(float value) { return _mm_set1_ps(value); }
+		static inline Vector Load(const float * input) { return _mm_loadu_ps(input); }
+		static inline void Store(float * output, Vector value) { _mm_storeu_ps(output, value); }
+		static inline Vector Add(Vector value1, Vector value2) { return _mm_add_ps(value1, value2); }
+		static inline Vector Sub(Vector value1, Vector value2) { return _mm_sub_ps(value1, value2); }
+		static inline Vector Mul(Vector value1, Vector value2) { return _mm_mul_ps(value1, value2); }
+		static inline Vector Div(Vector value1, Vector value2) { return _mm_div_ps(value1, value2); }
+	};
+}
+
+/**
+ * @brief Retrieve the SSE2 kernels
+ * @param table The table that the kernels are written to
+ * @return bool True, as the kernels were built
+ */
+bool Math3DKernels::GetSse2(Math3DKernelTable& table)
+{
+	Math3DKernelSet<DoubleOps, FloatOps>::Fill(table, "SSE2");
+	return true;
+}
+
+#else
+
+/**
+ * @brief The SSE2 kernels are not available within this build
+ * @param table The table that the kernels would be written to
+ * @return bool False, as the kernels were not built
+ */
+bool Math3DKernels::GetSse2(Math3DKernelTable& table)
+{
+	return false;
+}
+
+#endif
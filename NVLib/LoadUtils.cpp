@@ -111,3 +111,33 @@ DepthFrame * LoadUtils::LoadDepthFrame(const string& colorPath, const string& de
 	Mat color = imread(colorPath); Mat depth = imread(depthPath, IMREAD_UNCHANGED);
 	return new DepthFrame(color, depth);
 }
+
+//--------------------------------------------------
+// Load Model
+//--------------------------------------------------
+
+/**
+ * @brief Load a model from a PLY file (ascii or binary)
+ * @param path The path of the PLY file
+ * @return Model* The resultant model
+ */
+Model * LoadUtils::LoadModel(const string& path) 
+{
+	auto reader = PlyReader(path);
+	return reader.ReadModel();
+}
+
+//--------------------------------------------------
+// Load Cloud
+//--------------------------------------------------
+
+/**
+ * @brief Load the vertices of a PLY file (ascii or binary) as a dense cloud
+ * @param path The path of the PLY file
+ * @return Mat A (vertex count x 1) CV_64FC(6) cloud holding (X, Y, Z, B, G, R)
+ */
+Mat LoadUtils::LoadCloud(const string& path) 
+{
+	auto reader = PlyReader(path);
+	return reader.ReadCloud();
+}
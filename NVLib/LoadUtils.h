@@ -15,6 +15,8 @@ using namespace cv;
 #include "Model/StereoFrame.h"
 #include "Model/StereoCalibration.h"
 #include "Model/DepthFrame.h"
+#include "Model/Model.h"
+#include "Ply/PlyReader.h"
 
 namespace NVLib
 {
@@ -27,5 +29,7 @@ namespace NVLib
 		static StereoFrame * LoadStereoFrame(const string& left, const string& right);
 		static StereoCalibration * LoadStereoCalibration(const string& path);
 		static DepthFrame * LoadDepthFrame(const string& color, const string& depth);
+		static Model * LoadModel(const string& path);
+		static Mat LoadCloud(const string& path);
 	};
 }
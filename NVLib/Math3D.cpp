@@ -74,6 +74,247 @@ Point3d Math3D::TransformPoint(const Mat& pose, const Point3d & point)
 	return Point3d(X, Y, Z);
 }
 
+//--------------------------------------------------
+// Fixed Size Overloads
+//--------------------------------------------------
+
+/**
+ * Project a point with the given camera, without reading a camera matrix
+ * @param camera The intrinsics of the camera
+ * @param point The point that we are projecting
+ * @return The projected point
+ */
+Point2d Math3D::Project(const PinholeCamera& camera, const Point3d& point)
+{
+	return camera.Project(point);
+}
+
+/**
+ * Find the original 3D point of an image point, given the camera and the depth
+ * @param camera The intrinsics of the camera
+ * @param point The image point that we are projecting back
+ * @param Z The depth expected in 3D space
+ * @return The original 3D location of the point
+ */
+Point3d Math3D::UnProject(const PinholeCamera& camera, const Point2d& point, double Z)
+{
+	return camera.UnProject(point, Z);
+}
+
+/**
+ * Transform a 3D point with a given pose, without reading a pose matrix
+ * @param pose The pose that we are transforming with
+ * @param point The point that we are transforming
+ * @return The transformed point
+ */
+Point3d Math3D::TransformPoint(const Pose3d& pose, const Point3d& point)
+{
+	return pose.Apply(point);
+}
+
+//--------------------------------------------------
+// Batched Operations
+//--------------------------------------------------
+
+/**
+ * Project a set of points (see Project)
+ * @param cameraMatrix The camera matrix that we are basing our projection upon
+ * @param points The points that we are projecting
+ * @param output The projected points (resized to match the input)
+ */
+void Math3D::ProjectPoints(const Mat& cameraMatrix, const vector<Point3d>& points, vector<Point2d>& output)
+{
+	output.resize(points.size());
+	if (!points.empty()) ProjectPoints(cameraMatrix, &points[0], &output[0], points.size());
+}
+
+/**
+ * Project a contiguous span of points, using the SIMD kernels of the current processor. The results are bit 
+ * identical to calling Project on each point.
+ * @param cameraMatrix The camera matrix that we are basing our projection upon
+ * @param points The points that we are projecting
+ * @param output The projected points
+ * @param count The number of points
+ */
+void Math3D::ProjectPoints(const Mat& cameraMatrix, const Point3d * points, Point2d * output, size_t count)
+{
+	double K[4]; GetIntrinsics(cameraMatrix, K);
+	Math3DKernels::Get().ProjectAoS(K, (const double *)points, (double *)output, count);
+}
+
+/**
+ * Project a set of points held as separate coordinate arrays
+ * @param cameraMatrix The camera matrix that we are basing our projection upon
+ * @param x The X coordinates of the points
+ * @param y The Y coordinates of the points
+ * @param z The Z coordinates of the points
+ * @param u The resultant horizontal image coordinates
+ * @param v The resultant vertical image coordinates
+ * @param count The number of points
+ */
+void Math3D::ProjectPoints(const Mat& cameraMatrix, const double * x, const double * y, const double * z, double * u, double * v, size_t count)
+{
+	double K[4]; GetIntrinsics(cameraMatrix, K);
+	Math3DKernels::Get().Project64(K, x, y, z, u, v, count);
+}
+
+/**
+ * Project a set of single precision points held as separate coordinate arrays (the arithmetic is single precision)
+ * @param cameraMatrix The camera matrix that we are basing our projection upon
+ * @param x The X coordinates of the points
+ * @param y The Y coordinates of the points
+ * @param z The Z coordinates of the points
+ * @param u The resultant horizontal image coordinates
+ * @param v The resultant vertical image coordinates
+ * @param count The number of points
+ */
+void Math3D::ProjectPoints(const Mat& cameraMatrix, const float * x, const float * y, const float * z, float * u, float * v, size_t count)
+{
+	double K[4]; GetIntrinsics(cameraMatrix, K);
+	float Kf[] = { (float)K[0], (float)K[1], (float)K[2], (float)K[3] };
+	Math3DKernels::Get().Project32(Kf, x, y, z, u, v, count);
+}
+
+/**
+ * Find the 3D points of a contiguous span of image points, given their depths (see UnProject)
+ * @param cameraMatrix The camera matrix defining the projecting transform
+ * @param points The image points that we are projecting back
+ * @param depth The depth of each point
+ * @param output The resultant 3D points
+ * @param count The number of points
+ */
+void Math3D::UnProjectPoints(const Mat& cameraMatrix, const Point2d * points, const double * depth, Point3d * output, size_t count)
+{
+	double K[4]; GetIntrinsics(cameraMatrix, K);
+	Math3DKernels::Get().UnProjectAoS(K, (const double *)points, depth, (double *)output, count);
+}
+
+/**
+ * Find the 3D points of a set of image points held as separate coordinate arrays (the Z coordinates are the depths)
+ * @param cameraMatrix The camera matrix defining the projecting transform
+ * @param u The horizontal image coordinates
+ * @param v The vertical image coordinates
+ * @param depth The depth of each point
+ * @param x The resultant X coordinates
+ * @param y The resultant Y coordinates
+ * @param count The number of points
+ */
+void Math3D::UnProjectPoints(const Mat& cameraMatrix, const double * u, const double * v, const double * depth, double * x, double * y, size_t count)
+{
+	double K[4]; GetIntrinsics(cameraMatrix, K);
+	Math3DKernels::Get().UnProject64(K, u, v, depth, x, y, count);
+}
+
+/**
+ * Find the 3D points of a set of single precision image points held as separate coordinate arrays
+ * @param cameraMatrix The camera matrix defining the projecting transform
+ * @param u The horizontal image coordinates
+ * @param v The vertical image coordinates
+ * @param depth The depth of each point
+ * @param x The resultant X coordinates
+ * @param y The resultant Y coordinates
+ * @param count The number of points
+ */
+void Math3D::UnProjectPoints(const Mat& cameraMatrix, const float * u, const float * v, const float * depth, float * x, float * y, size_t count)
+{
+	double K[4]; GetIntrinsics(cameraMatrix, K);
+	float Kf[] = { (float)K[0], (float)K[1], (float)K[2], (float)K[3] };
+	Math3DKernels::Get().UnProject32(Kf, u, v, depth, x, y, count);
+}
+
+/**
+ * Transform a contiguous span of points (see TransformPoint). The input and output may be the same span, and large 
+ * spans are split across threads.
+ * @param pose The 3x4 or 4x4 pose matrix that we are transforming with
+ * @param input The points that we are transforming
+ * @param output The transformed points
+ * @param count The number of points
+ */
+void Math3D::TransformPoints(const Mat& pose, const Point3d * input, Point3d * output, size_t count)
+{
+	double P[12]; GetPoseRows(pose, P);
+	auto& kernels = Math3DKernels::Get();
+	RunParallel(count, GRAIN_SIZE, [&](size_t start, size_t end) { kernels.TransformAoS(P, (const double *)(input + start), (double *)(output + start), end - start); });
+}
+
+/**
+ * Transform a set of points held as separate coordinate arrays. The input and output arrays may be the same.
+ * @param pose The 3x4 or 4x4 pose matrix that we are transforming with
+ * @param x The X coordinates of the points
+ * @param y The Y coordinates of the points
+ * @param z The Z coordinates of the points
+ * @param ox The resultant X coordinates
+ * @param oy The resultant Y coordinates
+ * @param oz The resultant Z coordinates
+ * @param count The number of points
+ */
+void Math3D::TransformPoints(const Mat& pose, const double * x, const double * y, const double * z, double * ox, double * oy, double * oz, size_t count)
+{
+	double P[12]; GetPoseRows(pose, P);
+	auto& kernels = Math3DKernels::Get();
+	RunParallel(count, GRAIN_SIZE, [&](size_t start, size_t end) { kernels.Transform64(P, x + start, y + start, z + start, ox + start, oy + start, oz + start, end - start); });
+}
+
+/**
+ * Transform a set of single precision points held as separate coordinate arrays (the arithmetic is single precision)
+ * @param pose The 3x4 or 4x4 pose matrix that we are transforming with
+ * @param x The X coordinates of the points
+ * @param y The Y coordinates of the points
+ * @param z The Z coordinates of the points
+ * @param ox The resultant X coordinates
+ * @param oy The resultant Y coordinates
+ * @param oz The resultant Z coordinates
+ * @param count The number of points
+ */
+void Math3D::TransformPoints(const Mat& pose, const float * x, const float * y, const float * z, float * ox, float * oy, float * oz, size_t count)
+{
+	double P[12]; GetPoseRows(pose, P);
+	float Pf[12]; for (auto i = 0; i < 12; i++) Pf[i] = (float)P[i];
+	auto& kernels = Math3DKernels::Get();
+	RunParallel(count, GRAIN_SIZE, [&](size_t start, size_t end) { kernels.Transform32(Pf, x + start, y + start, z + start, ox + start, oy + start, oz + start, end - start); });
+}
+
+/**
+ * Project a contiguous span of points with the given camera (see ProjectPoints)
+ * @param camera The intrinsics of the camera
+ * @param points The points that we are projecting
+ * @param output The projected points
+ * @param count The number of points
+ */
+void Math3D::ProjectPoints(const PinholeCamera& camera, const Point3d * points, Point2d * output, size_t count)
+{
+	double K[] = { camera.GetFx(), camera.GetFy(), camera.GetCx(), camera.GetCy() };
+	Math3DKernels::Get().ProjectAoS(K, (const double *)points, (double *)output, count);
+}
+
+/**
+ * Find the 3D points of a contiguous span of image points with the given camera (see UnProjectPoints)
+ * @param camera The intrinsics of the camera
+ * @param points The image points that we are projecting back
+ * @param depth The depth of each point
+ * @param output The resultant 3D points
+ * @param count The number of points
+ */
+void Math3D::UnProjectPoints(const PinholeCamera& camera, const Point2d * points, const double * depth, Point3d * output, size_t count)
+{
+	double K[] = { camera.GetFx(), camera.GetFy(), camera.GetCx(), camera.GetCy() };
+	Math3DKernels::Get().UnProjectAoS(K, (const double *)points, depth, (double *)output, count);
+}
+
+/**
+ * Transform a contiguous span of points with the given pose (see TransformPoints)
+ * @param pose The pose that we are transforming with
+ * @param input The points that we are transforming
+ * @param output The transformed points
+ * @param count The number of points
+ */
+void Math3D::TransformPoints(const Pose3d& pose, const Point3d * input, Point3d * output, size_t count)
+{
+	double P[12]; pose.GetRows(P);
+	auto& kernels = Math3DKernels::Get();
+	RunParallel(count, GRAIN_SIZE, [&](size_t start, size_t end) { kernels.TransformAoS(P, (const double *)(input + start), (double *)(output + start), end - start); });
+}
+
 //--------------------------------------------------
 // ExtractDepth
 //--------------------------------------------------
@@ -155,6 +396,54 @@ Mat Math3D::BuildKMatrix(double f, const Size& imageSize)
 	return Mat_<double>(3, 3) << fx, 0, cx, 0, fy, cy, 0, 0, 1;
 }
 
+//--------------------------------------------------
+// GetProjection
+//--------------------------------------------------
+
+/**
+ * @brief Build the 3x4 projection matrix K * [R | t] for a camera at the given pose
+ * @param cameraMatrix The 3x3 camera matrix
+ * @param pose The pose (3x4 or 4x4) that transforms points into the frame of the camera
+ * @return Matx34d The resultant projection matrix
+ */
+Matx34d Math3D::GetProjection(const Mat& cameraMatrix, const Mat& pose) 
+{
+	auto k = (double*)cameraMatrix.data;
+	auto p = (double*)pose.data;
+
+	auto result = Matx34d();
+	for (auto row = 0; row < 3; row++)
+	{
+		for (auto column = 0; column < 4; column++)
+		{
+			result(row, column) = k[row * 3 + 0] * p[column] + k[row * 3 + 1] * p[4 + column] + k[row * 3 + 2] * p[8 + column];
+		}
+	}
+
+	return result;
+}
+
+/**
+ * @brief Build the 3x4 projection matrix K * [R | t] from the fixed size camera and pose
+ * @param camera The intrinsics of the camera
+ * @param pose The pose that transforms points into the frame of the camera
+ * @return Matx34d The resultant projection matrix
+ */
+Matx34d Math3D::GetProjection(const PinholeCamera& camera, const Pose3d& pose)
+{
+	double P[12]; pose.GetRows(P);
+
+	auto result = Matx34d();
+	for (auto column = 0; column < 4; column++)
+	{
+		result(0, column) = camera.GetFx() * P[column] + camera.GetCx() * P[8 + column];
+		result(1, column) = camera.GetFy() * P[4 + column] + camera.GetCy() * P[8 + column];
+		result(2, column) = P[8 + column];
+	}
+
+	return result;
+}
+
 //--------------------------------------------------
 // GetViewLimits
 //--------------------------------------------------
@@ -167,18 +456,32 @@ Mat Math3D::BuildKMatrix(double f, const Size& imageSize)
  * @param zmax The maximum distance we care about from the camera
  */
 void Math3D::GetViewLimits(Mat& cameraMatrix, const Size& imageSize, double zmin, double zmax, vector<Point3d>& output)
+{
+	GetViewLimits(PinholeCamera::FromMat(cameraMatrix), imageSize, zmin, zmax, output);
+}
+
+/**
+ * Find the view limits for the given camera, without reading a camera matrix. The corners are added as the near
+ * plane (top left, top right, bottom right, bottom left) followed by the same corners on the far plane.
+ * @param camera The intrinsics of the given camera
+ * @param imageSize The size of the image that we are processing
+ * @param zmin The minimum distance we care about from the camera
+ * @param zmax The maximum distance we care about from the camera
+ * @param output The list that the eight corners are added to
+ */
+void Math3D::GetViewLimits(const PinholeCamera& camera, const Size& imageSize, double zmin, double zmax, vector<Point3d>& output)
 {
 	// Add the close points
-	output.push_back(UnProject(cameraMatrix, Point2d(0, 0), zmin));
-	output.push_back(UnProject(cameraMatrix, Point2d(imageSize.width, 0), zmin));
-	output.push_back(UnProject(cameraMatrix, Point2d(imageSize.width, imageSize.height), zmin));
-	output.push_back(UnProject(cameraMatrix, Point2d(0, imageSize.height), zmin));
+	output.push_back(camera.UnProject(Point2d(0, 0), zmin));
+	output.push_back(camera.UnProject(Point2d(imageSize.width, 0), zmin));
+	output.push_back(camera.UnProject(Point2d(imageSize.width, imageSize.height), zmin));
+	output.push_back(camera.UnProject(Point2d(0, imageSize.height), zmin));
 
 	// Add the far points
-	output.push_back(UnProject(cameraMatrix, Point2d(0, 0), zmax));
-	output.push_back(UnProject(cameraMatrix, Point2d(imageSize.width, 0), zmax));
-	output.push_back(UnProject(cameraMatrix, Point2d(imageSize.width, imageSize.height), zmax));
-	output.push_back(UnProject(cameraMatrix, Point2d(0, imageSize.height), zmax));
+	output.push_back(camera.UnProject(Point2d(0, 0), zmax));
+	output.push_back(camera.UnProject(Point2d(imageSize.width, 0), zmax));
+	output.push_back(camera.UnProject(Point2d(imageSize.width, imageSize.height), zmax));
+	output.push_back(camera.UnProject(Point2d(0, imageSize.height), zmax));
 }
 
 //--------------------------------------------------
@@ -187,15 +490,72 @@ void Math3D::GetViewLimits(Mat& cameraMatrix, const Size& imageSize, double zmin
 
 /**
  * Transform the given point set
+ * @param pose The 3x4 or 4x4 pose that we are transforming with
  * @param input The input set of points that we are transforming
- * @param output The output set of points after the transformation
+ * @param output The output set of points after the transformation (resized to match the input)
  */
 void Math3D::TransformPointSet(const Mat& pose, vector<Point3d>& input, vector<Point3d>& output)
 {
-	for (const auto& point : input)
-	{
-		output.push_back(TransformPoint(pose, point));
-	}
+	output.resize(input.size());
+	if (!input.empty()) TransformPoints(pose, &input[0], &output[0], input.size());
+}
+
+/**
+ * Transform the given point set in place
+ * @param pose The 3x4 or 4x4 pose that we are transforming with
+ * @param points The points that we are transforming
+ */
+void Math3D::TransformPointSet(const Mat& pose, vector<Point3d>& points)
+{
+	if (!points.empty()) TransformPoints(pose, &points[0], &points[0], points.size());
+}
+
+/**
+ * Transform the given point set with a fixed size pose
+ * @param pose The pose that we are transforming with
+ * @param input The input set of points that we are transforming
+ * @param output The output set of points after the transformation (resized to match the input)
+ */
+void Math3D::TransformPointSet(const Pose3d& pose, vector<Point3d>& input, vector<Point3d>& output)
+{
+	output.resize(input.size());
+	if (!input.empty()) TransformPoints(pose, &input[0], &output[0], input.size());
+}
+
+/**
+ * Transform the given point set in place with a fixed size pose
+ * @param pose The pose that we are transforming with
+ * @param points The points that we are transforming
+ */
+void Math3D::TransformPointSet(const Pose3d& pose, vector<Point3d>& points)
+{
+	if (!points.empty()) TransformPoints(pose, &points[0], &points[0], points.size());
+}
+
+/**
+ * Transform a point set held as separate coordinate arrays in place
+ * @param pose The 3x4 or 4x4 pose that we are transforming with
+ * @param x The X coordinates of the points
+ * @param y The Y coordinates of the points
+ * @param z The Z coordinates of the points
+ */
+void Math3D::TransformPointSet(const Mat& pose, vector<double>& x, vector<double>& y, vector<double>& z)
+{
+	if (x.size() != y.size() || x.size() != z.size()) throw runtime_error("The coordinate arrays need to be the same size");
+	if (!x.empty()) TransformPoints(pose, &x[0], &y[0], &z[0], &x[0], &y[0], &z[0], x.size());
+}
+
+/**
+ * Transform a single precision point set held as separate coordinate arrays in place
+ * @param pose The 3x4 or 4x4 pose that we are transforming with
+ * @param x The X coordinates of the points
+ * @param y The Y coordinates of the points
+ * @param z The Z coordinates of the points
+ */
+void Math3D::TransformPointSet(const Mat& pose, vector<float>& x, vector<float>& y, vector<float>& z)
+{
+	if (x.size() != y.size() || x.size() != z.size()) throw runtime_error("The coordinate arrays need to be the same size");
+	if (!x.empty()) TransformPoints(pose, &x[0], &y[0], &z[0], &x[0], &y[0], &z[0], x.size());
 }
 
 //--------------------------------------------------
@@ -306,35 +666,128 @@ double Math3D::GetDistance(Point3d& point1, Point3d& point2)
 //--------------------------------------------------
 
 /**
- * @brief Retrieve the bounds of a point cloud
+ * @brief Retrieve the bounds of a point cloud. Large clouds are reduced in parallel blocks, using the widest 
+ * min/max kernels available.
  * @param points the points that are making up the cloud
- * @return Vec6d(xmin, xmax, ymin, ymax, zmin, zmax) 
+ * @return Vec6d(xmin, xmax, ymin, ymax, zmin, zmax), or zeros if there are no points
  */
-Vec6d Math3D::GetCloudBounds(vector<Point3d>& points) 
+Vec6d Math3D::GetCloudBounds(const vector<Point3d>& points) 
 {
-	// Validate that I have at least 1 point
-	assert(points.size() >= 1);
+	if (points.empty()) return Vec6d();
 
-	// Get the first point and initialize the counters;
-	auto xmin = points[0].x; auto xmax = xmin;
-	auto ymin = points[0].y; auto ymax = ymin;
-	auto zmin = points[0].z; auto zmax = zmin;
+	auto input = (const double *)&points[0];
+	auto result = Vec6d(input[0], input[0], input[1], input[1], input[2], input[2]);
+	auto& kernels = Math3DKernels::Get(); mutex lock;
 
-	// Loop through the points and update the counters
-	for (auto& point : points) 
+	RunParallel(points.size(), GRAIN_SIZE, [&](size_t first, size_t last)
 	{
-		xmin = min(xmin, point.x);
-		xmax = max(xmax, point.x);
+		double bounds[6] = { input[first * 3], input[first * 3], input[first * 3 + 1], input[first * 3 + 1], input[first * 3 + 2], input[first * 3 + 2] };
+		kernels.BoundsAoS(input + first * 3, last - first, bounds);
 
-		ymin = min(ymin, point.y);
-		ymax = max(ymax, point.y);
+		lock_guard<mutex> guard(lock);
+		MergeBounds(bounds, result);
+	});
 
-		zmin = min(zmin, point.z);
-		zmax = max(zmax, point.z);
-	}
+	return result;
+}
 
-	// Return the result
-	return Vec6d(xmin, xmax, ymin, ymax, zmin, zmax);
+/**
+ * @brief Retrieve the bounds of a point cloud held as separate coordinate arrays
+ * @param x The X coordinates
+ * @param y The Y coordinates
+ * @param z The Z coordinates
+ * @param count The number of points
+ * @return Vec6d(xmin, xmax, ymin, ymax, zmin, zmax), or zeros if there are no points
+ */
+Vec6d Math3D::GetCloudBounds(const double * x, const double * y, const double * z, size_t count)
+{
+	if (count == 0) return Vec6d();
+
+	auto result = Vec6d(x[0], x[0], y[0], y[0], z[0], z[0]);
+	auto& kernels = Math3DKernels::Get(); mutex lock;
+
+	RunParallel(count, GRAIN_SIZE, [&](size_t first, size_t last)
+	{
+		double bounds[6] = { x[first], x[first], y[first], y[first], z[first], z[first] };
+		kernels.Bounds64(x + first, y + first, z + first, last - first, bounds);
+
+		lock_guard<mutex> guard(lock);
+		MergeBounds(bounds, result);
+	});
+
+	return result;
+}
+
+//--------------------------------------------------
+// Get Oriented Bounds
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve an oriented bounding box of a point cloud, aligned with the principal axes of the points. The 
+ * covariance is accumulated in a single parallel pass (relative to the first point, to limit cancellation) and 
+ * the extents along the axes are found in a second.
+ * @param points the points that are making up the cloud
+ * @param center The center of the box
+ * @param axes The axes of the box as the rows of a right handed rotation (largest spread first)
+ * @param extents The half sizes of the box along each of the axes
+ */
+void Math3D::GetOrientedBounds(const vector<Point3d>& points, Point3d& center, Matx33d& axes, Vec3d& extents)
+{
+	center = Point3d(); axes = Matx33d::eye(); extents = Vec3d();
+	if (points.empty()) return;
+
+	// Accumulate the sums and the sums of products
+	auto origin = points[0]; auto sums = Vec<double, 9>(); mutex lock;
+
+	RunParallel(points.size(), GRAIN_SIZE, [&](size_t first, size_t last)
+	{
+		auto blockSums = Vec<double, 9>();
+
+		for (auto i = first; i < last; i++)
+		{
+			auto X = points[i].x - origin.x; auto Y = points[i].y - origin.y; auto Z = points[i].z - origin.z;
+			blockSums[0] += X; blockSums[1] += Y; blockSums[2] += Z;
+			blockSums[3] += X * X; blockSums[4] += X * Y; blockSums[5] += X * Z;
+			blockSums[6] += Y * Y; blockSums[7] += Y * Z; blockSums[8] += Z * Z;
+		}
+
+		lock_guard<mutex> guard(lock);
+		sums += blockSums;
+	});
+
+	// Find the principal axes
+	auto n = (double)points.size(); auto mean = Vec3d(sums[0], sums[1], sums[2]) * (1.0 / n);
+
+	auto covariance = Matx33d(
+		sums[3] / n - mean[0] * mean[0], sums[4] / n - mean[0] * mean[1], sums[5] / n - mean[0] * mean[2],
+		sums[4] / n - mean[0] * mean[1], sums[6] / n - mean[1] * mean[1], sums[7] / n - mean[1] * mean[2],
+		sums[5] / n - mean[0] * mean[2], sums[7] / n - mean[1] * mean[2], sums[8] / n - mean[2] * mean[2]);
+
+	Vec3d values; GetEigenSymmetric(covariance, values, axes);
+
+	auto third = Vec3d(axes(0, 0), axes(0, 1), axes(0, 2)).cross(Vec3d(axes(1, 0), axes(1, 1), axes(1, 2)));
+	axes(2, 0) = third[0]; axes(2, 1) = third[1]; axes(2, 2) = third[2];
+
+	// Find the extents along the axes
+	auto centroid = Vec3d(origin) + mean; auto limits = Vec6d(DBL_MAX, -DBL_MAX, DBL_MAX, -DBL_MAX, DBL_MAX, -DBL_MAX);
+
+	RunParallel(points.size(), GRAIN_SIZE, [&](size_t first, size_t last)
+	{
+		double bounds[6] = { DBL_MAX, -DBL_MAX, DBL_MAX, -DBL_MAX, DBL_MAX, -DBL_MAX };
+
+		for (auto i = first; i < last; i++)
+		{
+			auto offset = Vec3d(points[i]) - centroid; auto local = axes * offset;
+			for (auto axis = 0; axis < 3; axis++) { bounds[axis * 2] = min(bounds[axis * 2], local[axis]); bounds[axis * 2 + 1] = max(bounds[axis * 2 + 1], local[axis]); }
+		}
+
+		lock_guard<mutex> guard(lock);
+		MergeBounds(bounds, limits);
+	});
+
+	auto middle = Vec3d((limits[0] + limits[1]) * 0.5, (limits[2] + limits[3]) * 0.5, (limits[4] + limits[5]) * 0.5);
+	center = Point3d(centroid + axes.t() * middle);
+	extents = Vec3d((limits[1] - limits[0]) * 0.5, (limits[3] - limits[2]) * 0.5, (limits[5] - limits[4]) * 0.5);
 }
 
 //--------------------------------------------------
@@ -369,3 +822,126 @@ double Math3D::GetMagnitude(const Vec3d& vector)
 {
 	return sqrt(vector[0] * vector[0] + vector[1] * vector[1] + vector[2] * vector[2]);
 }
+
+//--------------------------------------------------
+// GetEigenSymmetric
+//--------------------------------------------------
+
+/**
+ * @brief Find the eigen decomposition of a symmetric 3x3 matrix, using Jacobi rotations (no heap allocations)
+ * @param matrix The symmetric matrix that we are decomposing
+ * @param values The eigenvalues in descending order
+ * @param vectors The eigenvectors, held as the rows of the matrix (matching cv::eigen)
+ */
+void Math3D::GetEigenSymmetric(const Matx33d& matrix, Vec3d& values, Matx33d& vectors) 
+{
+	auto a = matrix; auto v = Matx33d::eye();
+
+	for (auto sweep = 0; sweep < 50; sweep++)
+	{
+		auto off = a(0, 1) * a(0, 1) + a(0, 2) * a(0, 2) + a(1, 2) * a(1, 2);
+		auto scale = a(0, 0) * a(0, 0) + a(1, 1) * a(1, 1) + a(2, 2) * a(2, 2);
+		if (off <= 1e-30 * scale || off == 0) break;
+
+		for (auto p = 0; p < 2; p++)
+		{
+			for (auto q = p + 1; q < 3; q++)
+			{
+				if (a(p, q) == 0) continue;
+
+				// Find the rotation that zeros the (p, q) element
+				auto theta = (a(q, q) - a(p, p)) / (2 * a(p, q));
+				auto t = (theta >= 0 ? 1.0 : -1.0) / (fabs(theta) + sqrt(theta * theta + 1));
+				auto c = 1 / sqrt(t * t + 1); auto s = t * c;
+
+				for (auto k = 0; k < 3; k++)
+				{
+					auto akp = a(k, p); auto akq = a(k, q);
+					a(k, p) = c * akp - s * akq; a(k, q) = s * akp + c * akq;
+				}
+
+				for (auto k = 0; k < 3; k++)
+				{
+					auto apk = a(p, k); auto aqk = a(q, k);
+					a(p, k) = c * apk - s * aqk; a(q, k) = s * apk + c * aqk;
+				}
+
+				for (auto k = 0; k < 3; k++)
+				{
+					auto vkp = v(k, p); auto vkq = v(k, q);
+					v(k, p) = c * vkp - s * vkq; v(k, q) = s * vkp + c * vkq;
+				}
+			}
+		}
+	}
+
+	// Sort into descending order, with the eigenvectors as rows
+	int order[] = { 0, 1, 2 };
+	sort(order, order + 3, [&](int i, int j) { return a(i, i) > a(j, j); });
+
+	for (auto i = 0; i < 3; i++)
+	{
+		values[i] = a(order[i], order[i]);
+		for (auto k = 0; k < 3; k++) vectors(i, k) = v(k, order[i]);
+	}
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Extract the intrinsics that the kernels work with from a camera matrix
+ * @param cameraMatrix The 3x3 CV_64F camera matrix
+ * @param K The resultant (fx, fy, cx, cy)
+ */
+void Math3D::GetIntrinsics(const Mat& cameraMatrix, double * K)
+{
+	if (cameraMatrix.type() != CV_64F || cameraMatrix.total() != 9) throw runtime_error("The camera matrix is expected to be a 3x3 CV_64F matrix");
+
+	auto cdata = (double*)cameraMatrix.data;
+	K[0] = cdata[0]; K[1] = cdata[4]; K[2] = cdata[2]; K[3] = cdata[5];
+}
+
+/**
+ * @brief Extract the first three rows of a pose
+ * @param pose The 3x4 or 4x4 CV_64F pose matrix
+ * @param P The resultant 12 values (row major)
+ */
+void Math3D::GetPoseRows(const Mat& pose, double * P)
+{
+	if (pose.type() != CV_64F || pose.total() < 12) throw runtime_error("The pose is expected to be a 3x4 or 4x4 CV_64F matrix");
+
+	auto data = (double*)pose.data;
+	for (auto i = 0; i < 12; i++) P[i] = data[i];
+}
+
+/**
+ * @brief Split a batch into contiguous blocks that are processed in parallel (batches that only fill a single block
+ * are run directly on the calling thread)
+ * @param count The number of items in the batch
+ * @param grainSize The smallest number of items that is worth handing to a worker thread
+ * @param action The action that processes the items [start, end)
+ */
+void Math3D::RunParallel(size_t count, size_t grainSize, const function<void(size_t, size_t)>& action)
+{
+	if (count == 0) return;
+
+	auto blockCount = (int)min(count / max(grainSize, (size_t)1), (size_t)getNumThreads() * 4);
+	if (blockCount <= 1) { action(0, count); return; }
+
+	parallel_for_(cv::Range(0, blockCount), [&](const cv::Range& range)
+	{
+		for (auto block = range.start; block < range.end; block++) action(count * block / blockCount, count * (block + 1) / blockCount);
+	});
+}
+
+/**
+ * @brief Widen a set of bounds so that they contain another set of bounds
+ * @param bounds The bounds that are being added (xmin, xmax, ymin, ymax, zmin, zmax)
+ * @param result The bounds that are being widened
+ */
+void Math3D::MergeBounds(const double * bounds, Vec6d& result)
+{
+	for (auto i = 0; i < 6; i += 2) { result[i] = min(result[i], bounds[i]); result[i + 1] = max(result[i + 1], bounds[i + 1]); }
+}
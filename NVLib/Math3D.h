@@ -6,12 +6,18 @@
 
 #pragma once
 
+#include <mutex>
+#include <functional>
 #include <iostream>
 using namespace std;
 
 #include <opencv2/opencv.hpp>
 using namespace cv;
 
+#include "Kernels/Math3DKernels.h"
+#include "Model/Pose3d.h"
+#include "Model/PinholeCamera.h"
+
 namespace NVLib
 {
 	class Math3D
@@ -20,19 +26,54 @@ namespace NVLib
 		static Point2d Project(const Mat& cameraMatrix, const Point3d& point);
 		static Point3d UnProject(const Mat& cameraMatrix, const Point2d& point, double Z);
 		static Point3d TransformPoint(const Mat& pose, const Point3d & point);
+		static Point2d Project(const PinholeCamera& camera, const Point3d& point);
+		static Point3d UnProject(const PinholeCamera& camera, const Point2d& point, double Z);
+		static Point3d TransformPoint(const Pose3d& pose, const Point3d& point);
+		static void ProjectPoints(const Mat& cameraMatrix, const vector<Point3d>& points, vector<Point2d>& output);
+		static void ProjectPoints(const Mat& cameraMatrix, const Point3d * points, Point2d * output, size_t count);
+		static void ProjectPoints(const Mat& cameraMatrix, const double * x, const double * y, const double * z, double * u, double * v, size_t count);
+		static void ProjectPoints(const Mat& cameraMatrix, const float * x, const float * y, const float * z, float * u, float * v, size_t count);
+		static void UnProjectPoints(const Mat& cameraMatrix, const Point2d * points, const double * depth, Point3d * output, size_t count);
+		static void UnProjectPoints(const Mat& cameraMatrix, const double * u, const double * v, const double * depth, double * x, double * y, size_t count);
+		static void UnProjectPoints(const Mat& cameraMatrix, const float * u, const float * v, const float * depth, float * x, float * y, size_t count);
+		static void TransformPoints(const Mat& pose, const Point3d * input, Point3d * output, size_t count);
+		static void TransformPoints(const Mat& pose, const double * x, const double * y, const double * z, double * ox, double * oy, double * oz, size_t count);
+		static void TransformPoints(const Mat& pose, const float * x, const float * y, const float * z, float * ox, float * oy, float * oz, size_t count);
+		static void ProjectPoints(const PinholeCamera& camera, const Point3d * points, Point2d * output, size_t count);
+		static void UnProjectPoints(const PinholeCamera& camera, const Point2d * points, const double * depth, Point3d * output, size_t count);
+		static void TransformPoints(const Pose3d& pose, const Point3d * input, Point3d * output, size_t count);
 		static double ExtractDepth(Mat& depthMap, const Point2d & position);
 		static Vec3i ExtractColor(Mat& colorMap, const Point2d& position);
 		static Mat ExtractK(Mat& Q);
 		static Mat BuildKMatrix(double f, const Size& imageSize);
+		static Matx34d GetProjection(const Mat& cameraMatrix, const Mat& pose);
+		static Matx34d GetProjection(const PinholeCamera& camera, const Pose3d& pose);
 		static void GetViewLimits(Mat& cameraMatrix, const Size& imageSize, double zmin, double zmax, vector<Point3d>& output);
+		static void GetViewLimits(const PinholeCamera& camera, const Size& imageSize, double zmin, double zmax, vector<Point3d>& output);
 		static void TransformPointSet(const Mat& pose, vector<Point3d>& input, vector<Point3d>& output);
+		static void TransformPointSet(const Mat& pose, vector<Point3d>& points);
+		static void TransformPointSet(const Pose3d& pose, vector<Point3d>& input, vector<Point3d>& output);
+		static void TransformPointSet(const Pose3d& pose, vector<Point3d>& points);
+		static void TransformPointSet(const Mat& pose, vector<double>& x, vector<double>& y, vector<double>& z);
+		static void TransformPointSet(const Mat& pose, vector<float>& x, vector<float>& y, vector<float>& z);
 		static Vec3d NormalizeVector(const Vec3d& vector);
 		static Mat GetOrientationRotation(const Vec3d& newNormal, const Vec3d& oldNormal);
 		static Point3d RotatePoint(Mat& rotation, const Point3d& point);
 		static Vec3d RotateVector(Mat& rotation, const Vec3d& vector);
 		static double GetDistance(Point3d& point1, Point3d& point2);
-		static Vec6d GetCloudBounds(vector<Point3d>& points);
+		static Vec6d GetCloudBounds(const vector<Point3d>& points);
+		static Vec6d GetCloudBounds(const double * x, const double * y, const double * z, size_t count);
+		static void GetOrientedBounds(const vector<Point3d>& points, Point3d& center, Matx33d& axes, Vec3d& extents);
 		static double GetLinePointDistance(const Point3d& start, const Vec3d& gradient, const Point3d& point);
 		static double GetMagnitude(const Vec3d& vector);
+		static void GetEigenSymmetric(const Matx33d& matrix, Vec3d& values, Matx33d& vectors);
+		static void RunParallel(size_t count, size_t grainSize, const function<void(size_t, size_t)>& action);
+	private:
+		// The smallest block of points that is worth handing to a worker thread (smaller batches run directly)
+		static constexpr size_t GRAIN_SIZE = 16384;
+
+		static void GetIntrinsics(const Mat& cameraMatrix, double * K);
+		static void GetPoseRows(const Mat& pose, double * P);
+		static void MergeBounds(const double * bounds, Vec6d& result);
 	};
 }
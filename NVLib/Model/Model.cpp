@@ -16,32 +16,131 @@ using namespace NVLib;
 /**
  * @brief Default Constructor
  */
-Model::Model()
+Model::Model() : _boundsValid(false)
 {
 	// Additional implementation can go here
 }
 
+/**
+ * @brief Copy Constructor (the bounds are found again by the copy, as the lock that guards them is not copied)
+ * @param other The model that we are copying
+ */
+Model::Model(const Model& other) : _x(other._x), _y(other._y), _z(other._z), _colors(other._colors), _boundsValid(false)
+{
+	// Additional implementation can go here
+}
+
+/**
+ * @brief Copy Assignment
+ * @param other The model that we are copying
+ * @return Model& This model
+ */
+Model& Model::operator=(const Model& other)
+{
+	if (this == &other) return *this;
+
+	_x = other._x; _y = other._y; _z = other._z; _colors = other._colors;
+	_boundsValid = false;
+
+	return *this;
+}
+
 //--------------------------------------------------
 // Update
 //--------------------------------------------------
 
+/**
+ * @brief Reserve space for a number of vertices
+ * @param count The number of vertices that we expect the model to hold
+ */
+void Model::Reserve(int count)
+{
+	_x.reserve(count); _y.reserve(count); _z.reserve(count); _colors.reserve(count);
+}
+
+/**
+ * @brief Set the number of vertices (new vertices are zero)
+ * @param count The number of vertices that the model holds
+ */
+void Model::Resize(int count)
+{
+	_x.resize(count); _y.resize(count); _z.resize(count); _colors.resize(count);
+	_boundsValid = false;
+}
+
 /**
  * @brief Add a vertex to the system
  * @param vertex The vertex that we are adding
  */
 void Model::AddVertex(ColorPoint& vertex)
 {
-	_vertices.push_back(vertex);
+	AddVertex(vertex.GetLocation(), vertex.GetColor());
 }
 
 /**
  * @brief Add a vertex to the model
  * @param vertex The vertex that we are adding
- * @param color The color the vertex
+ * @param color The color the vertex (channels are clamped to [0, 255])
  */
 void Model::AddVertex(const Point3d& vertex, const Vec3i& color) 
 {
-	_vertices.push_back(ColorPoint(vertex, color));
+	_x.push_back(vertex.x); _y.push_back(vertex.y); _z.push_back(vertex.z);
+	_boundsValid = false;
+	_colors.push_back(Vec3b(saturate_cast<uchar>(color[0]), saturate_cast<uchar>(color[1]), saturate_cast<uchar>(color[2])));
+}
+
+/**
+ * @brief Add a set of vertices to the model
+ * @param vertices The locations of the vertices
+ * @param colors The colors of the vertices
+ */
+void Model::AddVertices(const vector<Point3d>& vertices, const vector<Vec3b>& colors)
+{
+	if (vertices.size() != colors.size()) throw runtime_error("There needs to be a color for each vertex");
+
+	auto start = _x.size(); auto count = vertices.size();
+	_x.resize(start + count); _y.resize(start + count); _z.resize(start + count);
+	_colors.insert(_colors.end(), colors.begin(), colors.end());
+	_boundsValid = false;
+
+	for (auto i = (size_t)0; i < count; i++) 
+	{
+		_x[start + i] = vertices[i].x; _y[start + i] = vertices[i].y; _z[start + i] = vertices[i].z;
+	}
+}
+
+/**
+ * @brief Add the valid (Z != 0) points of a color cloud to the model
+ * @param colorCloud The CV_64FC(6) cloud holding (X, Y, Z, B, G, R)
+ */
+void Model::AddVertices(Mat& colorCloud)
+{
+	if (colorCloud.type() != CV_64FC(6)) throw runtime_error("The color cloud is expected to be of type CV_64FC(6)");
+
+	auto count = (size_t)0;
+	for (auto row = 0; row < colorCloud.rows; row++)
+	{
+		auto input = colorCloud.ptr<double>(row);
+		for (auto column = 0; column < colorCloud.cols; column++) if (input[column * 6 + 2] != 0) count++;
+	}
+
+	auto position = _x.size();
+	_x.resize(position + count); _y.resize(position + count); _z.resize(position + count); _colors.resize(position + count);
+	_boundsValid = false;
+
+	for (auto row = 0; row < colorCloud.rows; row++)
+	{
+		auto input = colorCloud.ptr<double>(row);
+
+		for (auto column = 0; column < colorCloud.cols; column++)
+		{
+			auto point = input + column * 6;
+			if (point[2] == 0) continue;
+
+			_x[position] = point[0]; _y[position] = point[1]; _z[position] = point[2];
+			_colors[position++] = Vec3b(saturate_cast<uchar>(point[3]), saturate_cast<uchar>(point[4]), saturate_cast<uchar>(point[5]));
+		}
+	}
 }
 
 //--------------------------------------------------
@@ -54,18 +153,24 @@ void Model::AddVertex(const Point3d& vertex, const Vec3i& color)
  */
 void Model::Transform(Mat& transform) 
 {
-	auto t = (double *) transform.data;
-
-	for (auto& vertex : _vertices) 
-	{
-		auto p = vertex.GetLocation();
+	if (!_x.empty()) Math3D::TransformPoints(transform, &_x[0], &_y[0], &_z[0], &_x[0], &_y[0], &_z[0], _x.size());
 
-		auto X = p.x * t[0] + p.y * t[1] + p.z * t[2] + t[3];
-		auto Y = p.x * t[4] + p.y * t[5] + p.z * t[6] + t[7];
-		auto Z = p.x * t[8] + p.y * t[9] + p.z * t[10] + t[11];
+	_boundsValid = false;
+}
 
-		vertex.GetLocation().x = X;  vertex.GetLocation().y = Y; vertex.GetLocation().z = Z;
-	}
+/**
+ * @brief Retrieve writable pointers to the vertex arrays, so that they can be filled in place (for example, in
+ * parallel after a call to Resize()). The cached bounds are dropped, so the arrays must not be edited while the
+ * bounds are being read.
+ * @param x The X coordinates
+ * @param y The Y coordinates
+ * @param z The Z coordinates
+ * @param colors The colors
+ */
+void Model::EditVertices(double *& x, double *& y, double *& z, Vec3b *& colors)
+{
+	x = _x.data(); y = _y.data(); z = _z.data(); colors = _colors.data();
+	_boundsValid = false;
 }
 
 //--------------------------------------------------
@@ -78,5 +183,36 @@ void Model::Transform(Mat& transform)
  */
 int Model::VertexCount()
 {
-	return (int)_vertices.size();
-}
\ No newline at end of file
+	return (int)_x.size();
+}
+
+/**
+ * @brief Retrieve a vertex of the model
+ * @param index The index of the vertex
+ * @return ColorPoint A copy of the vertex
+ */
+ColorPoint Model::GetVertex(int index)
+{
+	return ColorPoint(GetLocation(index), GetColor(index));
+}
+
+/**
+ * @brief Retrieve the axis aligned bounds of the vertices. The bounds are found with a parallel SIMD reduction and
+ * cached until the model is changed. The cache is filled under a lock, so the bounds of a shared model can be
+ * requested from several threads at once.
+ * @return Vec6d The bounds (xmin, xmax, ymin, ymax, zmin, zmax), or zeros for an empty model
+ */
+Vec6d Model::GetBounds()
+{
+	if (_boundsValid.load(memory_order_acquire)) return _bounds;
+
+	lock_guard<mutex> guard(_boundsLock);
+
+	if (!_boundsValid.load(memory_order_relaxed))
+	{
+		_bounds = _x.empty() ? Vec6d() : Math3D::GetCloudBounds(&_x[0], &_y[0], &_z[0], _x.size());
+		_boundsValid.store(true, memory_order_release);
+	}
+
+	return _bounds;
+}
@@ -8,28 +8,53 @@
 
 #pragma once
 
+#include <mutex>
+#include <atomic>
 #include <vector>
 #include <iostream>
 using namespace std;
 
 #include "ColorPoint.h"
+#include "../Math3D.h"
 
 namespace NVLib
 {
 	class Model
 	{
 		private:
-			vector<ColorPoint> _vertices;
+			vector<double> _x;
+			vector<double> _y;
+			vector<double> _z;
+			vector<Vec3b> _colors;
+			Vec6d _bounds;
+			atomic<bool> _boundsValid;
+			mutex _boundsLock;
 
 		public:
 			Model();
+			Model(const Model& other);
+			Model& operator=(const Model& other);
 
+			void Reserve(int count);
+			void Resize(int count);
 			void AddVertex(ColorPoint& vertex);
 			void AddVertex(const Point3d& vertex, const Vec3i& color);
+			void AddVertices(const vector<Point3d>& vertices, const vector<Vec3b>& colors);
+			void AddVertices(Mat& colorCloud);
 			void Transform(Mat& transform);
+			void EditVertices(double *& x, double *& y, double *& z, Vec3b *& colors);
 
 			int VertexCount();
+			ColorPoint GetVertex(int index);
+			Vec6d GetBounds();
+			inline void InvalidateBounds() { _boundsValid = false; }
 
-			inline vector<ColorPoint>& GetVertices() { return _vertices; }
+			inline Point3d GetLocation(int index) { return Point3d(_x[index], _y[index], _z[index]); }
+			inline Vec3i GetColor(int index) { return Vec3i(_colors[index][0], _colors[index][1], _colors[index][2]); }
+
+			inline const vector<double>& GetX() const { return _x; }
+			inline const vector<double>& GetY() const { return _y; }
+			inline const vector<double>& GetZ() const { return _z; }
+			inline const vector<Vec3b>& GetColors() const { return _colors; }
 	};
 }
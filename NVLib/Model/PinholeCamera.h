@@ -0,0 +1,61 @@
+//--------------------------------------------------
+// Model: The intrinsics of a pinhole camera (fx, fy, cx, cy), held on the stack so that they can be used 
+// within tight loops
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+namespace NVLib
+{
+	class PinholeCamera
+	{
+	private:
+		double _fx;
+		double _fy;
+		double _cx;
+		double _cy;
+	public:
+		constexpr PinholeCamera() : _fx(1), _fy(1), _cx(0), _cy(0) {}
+		constexpr PinholeCamera(double fx, double fy, double cx, double cy) : _fx(fx), _fy(fy), _cx(cx), _cy(cy) {}
+
+		/**
+		 * @brief Create the camera from a camera matrix
+		 * @param cameraMatrix The 3x3 CV_64F camera matrix
+		 * @return PinholeCamera The resultant camera
+		 */
+		static PinholeCamera FromMat(const Mat& cameraMatrix) 
+		{
+			if (cameraMatrix.type() != CV_64F || cameraMatrix.total() != 9) throw runtime_error("The camera matrix is expected to be a 3x3 CV_64F matrix");
+			auto K = (const double *)cameraMatrix.data;
+			return PinholeCamera(K[0], K[4], K[2], K[5]);
+		}
+
+		inline Point2d Project(const Point3d& point) const 
+		{
+			return Point2d((_fx * point.x / point.z) + _cx, (_fy * point.y / point.z) + _cy);
+		}
+
+		inline Point3d UnProject(const Point2d& point, double Z) const 
+		{
+			return Point3d((point.x - _cx) * (Z / _fx), (point.y - _cy) * (Z / _fy), Z);
+		}
+
+		inline Matx33d ToMatx() const { return Matx33d(_fx, 0, _cx, 0, _fy, _cy, 0, 0, 1); }
+		inline Mat ToMat() const { return Mat(ToMatx()); }
+
+		constexpr double GetFx() const { return _fx; }
+		constexpr double GetFy() const { return _fy; }
+		constexpr double GetCx() const { return _cx; }
+		constexpr double GetCy() const { return _cy; }
+	};
+}
@@ -0,0 +1,121 @@
+//--------------------------------------------------
+// Implementation of class PointCloud
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "PointCloud.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Default Constructor
+ */
+PointCloud::PointCloud() : _width(0), _height(0)
+{
+	// Extra implementation can go here
+}
+
+/**
+ * @brief Create an organized cloud of the given dimensions (height = 1 gives an unorganized cloud)
+ * @param width The width of the cloud
+ * @param height The height of the cloud
+ */
+PointCloud::PointCloud(int width, int height) : _width(0), _height(0)
+{
+	Resize(width, height);
+}
+
+//--------------------------------------------------
+// Update
+//--------------------------------------------------
+
+/**
+ * @brief Resize the cloud, all points are marked as invalid
+ * @param width The new width of the cloud
+ * @param height The new height of the cloud
+ */
+void PointCloud::Resize(int width, int height)
+{
+	_width = width; _height = height;
+	auto size = (size_t)width * height;
+
+	_x.assign(size, 0); _y.assign(size, 0); _z.assign(size, 0);
+	_colors.assign(size * 3, 0);
+	_validity.assign((size + 63) / 64, 0);
+	_indices.clear();
+}
+
+/**
+ * @brief Set the values of a point and mark it as valid
+ * @param index The index of the point (column + row * width)
+ * @param location The location of the point
+ * @param color The color of the point
+ */
+void PointCloud::SetPoint(int index, const Point3f& location, const Vec3b& color)
+{
+	_x[index] = location.x; _y[index] = location.y; _z[index] = location.z;
+	for (auto i = 0; i < 3; i++) _colors[index * 3 + i] = color[i];
+	SetValid(index, true);
+}
+
+/**
+ * @brief Rebuild the compacted list of valid point indices from the validity bitmap
+ */
+void PointCloud::UpdateIndices()
+{
+	_indices.clear(); _indices.reserve(ValidCount());
+
+	for (auto word = 0; word < (int)_validity.size(); word++)
+	{
+		auto bits = _validity[word];
+		if (bits == 0) continue;
+
+		for (auto bit = 0; bit < 64; bit++)
+		{
+			if ((bits >> bit) & 1) _indices.push_back(word * 64 + bit);
+		}
+	}
+}
+
+//--------------------------------------------------
+// Validity
+//--------------------------------------------------
+
+/**
+ * @brief Determine whether the given point is valid
+ * @param index The index of the point
+ * @return bool True if the point is valid
+ */
+bool PointCloud::IsValid(int index) const
+{
+	return ((_validity[index >> 6] >> (index & 63)) & 1) != 0;
+}
+
+/**
+ * @brief Set the validity of the given point
+ * @param index The index of the point
+ * @param valid The validity state
+ */
+void PointCloud::SetValid(int index, bool valid)
+{
+	auto mask = (uint64_t)1 << (index & 63);
+	if (valid) _validity[index >> 6] |= mask;
+	else _validity[index >> 6] &= ~mask;
+}
+
+/**
+ * @brief Count the number of valid points within the cloud
+ * @return int The number of valid points
+ */
+int PointCloud::ValidCount() const
+{
+	auto result = 0;
+	for (auto word : _validity) result += (int)bitset<64>(word).count();
+	return result;
+}
@@ -0,0 +1,60 @@
+//--------------------------------------------------
+// Model: A compact structure-of-arrays point cloud
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <bitset>
+#include <vector>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+namespace NVLib
+{
+	class PointCloud
+	{
+		private:
+			int _width;
+			int _height;
+			vector<float> _x;
+			vector<float> _y;
+			vector<float> _z;
+			vector<uchar> _colors;
+			vector<uint64_t> _validity;
+			vector<int> _indices;
+
+		public:
+			PointCloud();
+			PointCloud(int width, int height);
+
+			void Resize(int width, int height);
+			void SetPoint(int index, const Point3f& location, const Vec3b& color);
+			void UpdateIndices();
+
+			bool IsValid(int index) const;
+			void SetValid(int index, bool valid);
+			int ValidCount() const;
+
+			inline Point3f GetLocation(int index) const { return Point3f(_x[index], _y[index], _z[index]); }
+			inline Vec3b GetColor(int index) const { return Vec3b(_colors[index * 3 + 0], _colors[index * 3 + 1], _colors[index * 3 + 2]); }
+
+			inline int GetWidth() const { return _width; }
+			inline int GetHeight() const { return _height; }
+			inline int GetSize() const { return _width * _height; }
+			inline bool IsOrganized() const { return _height > 1; }
+
+			inline vector<float>& GetX() { return _x; }
+			inline vector<float>& GetY() { return _y; }
+			inline vector<float>& GetZ() { return _z; }
+			inline vector<uchar>& GetColors() { return _colors; }
+			inline vector<uint64_t>& GetValidity() { return _validity; }
+			inline vector<int>& GetIndices() { return _indices; }
+	};
+}
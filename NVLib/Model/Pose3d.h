@@ -0,0 +1,95 @@
+//--------------------------------------------------
+// Model: A fixed size rigid transform (rotation and translation), held on the stack so that it can be used 
+// within tight loops
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "Rotation3d.h"
+
+namespace NVLib
+{
+	class Pose3d
+	{
+	private:
+		Rotation3d _rotation;
+		Vec3d _translation;
+	public:
+		Pose3d() : _translation(0, 0, 0) {}
+		Pose3d(const Rotation3d& rotation, const Vec3d& translation) : _rotation(rotation), _translation(translation) {}
+
+		explicit Pose3d(const Matx44d& pose) : 
+			_rotation(Matx33d(pose(0, 0), pose(0, 1), pose(0, 2), pose(1, 0), pose(1, 1), pose(1, 2), pose(2, 0), pose(2, 1), pose(2, 2))), 
+			_translation(pose(0, 3), pose(1, 3), pose(2, 3)) {}
+
+		/**
+		 * @brief Create a pose from a 3x4 or 4x4 CV_64F matrix
+		 * @param pose The matrix that we are reading
+		 * @return Pose3d The resultant pose
+		 */
+		static Pose3d FromMat(const Mat& pose) 
+		{
+			if (pose.type() != CV_64F || pose.total() < 12) throw runtime_error("The pose is expected to be a 3x4 or 4x4 CV_64F matrix");
+			auto P = (const double *)pose.data;
+			return Pose3d(Rotation3d(Matx33d(P[0], P[1], P[2], P[4], P[5], P[6], P[8], P[9], P[10])), Vec3d(P[3], P[7], P[11]));
+		}
+
+		/**
+		 * @brief Create a pose from a rotation vector and a translation vector (see PoseUtils::Vectors2Pose)
+		 * @param rvec The rotation vector
+		 * @param tvec The translation vector
+		 * @return Pose3d The resultant pose
+		 */
+		static Pose3d FromVectors(const Vec3d& rvec, const Vec3d& tvec) 
+		{
+			return Pose3d(Rotation3d::FromVector(rvec), tvec);
+		}
+
+		inline Point3d Apply(const Point3d& point) const 
+		{
+			auto& R = _rotation.GetMatrix().val; auto& t = _translation;
+			return Point3d(R[0] * point.x + R[1] * point.y + R[2] * point.z + t[0], R[3] * point.x + R[4] * point.y + R[5] * point.z + t[1], R[6] * point.x + R[7] * point.y + R[8] * point.z + t[2]);
+		}
+
+		inline Pose3d operator*(const Pose3d& other) const 
+		{
+			auto translation = _rotation.Apply(other._translation);
+			return Pose3d(_rotation * other._rotation, Vec3d(translation[0] + _translation[0], translation[1] + _translation[1], translation[2] + _translation[2]));
+		}
+
+		inline Pose3d Inverse() const 
+		{
+			auto rotation = _rotation.Inverse(); auto translation = rotation.Apply(_translation);
+			return Pose3d(rotation, Vec3d(-translation[0], -translation[1], -translation[2]));
+		}
+
+		inline Matx44d ToMatx() const 
+		{
+			auto& R = _rotation.GetMatrix().val; auto& t = _translation;
+			auto result = Matx44d::eye();
+			for (auto row = 0; row < 3; row++) { for (auto column = 0; column < 3; column++) result(row, column) = R[row * 3 + column]; result(row, 3) = t[row]; }
+			return result;
+		}
+
+		inline Mat ToMat() const { return Mat(ToMatx()); }
+
+		inline void GetRows(double * P) const 
+		{
+			auto& R = _rotation.GetMatrix().val;
+			for (auto row = 0; row < 3; row++) { for (auto column = 0; column < 3; column++) P[row * 4 + column] = R[row * 3 + column]; P[row * 4 + 3] = _translation[row]; }
+		}
+
+		inline const Rotation3d& GetRotation() const { return _rotation; }
+		inline const Vec3d& GetTranslation() const { return _translation; }
+	};
+}
@@ -0,0 +1,164 @@
+//--------------------------------------------------
+// Implementation of class Rotation3d
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "Rotation3d.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Creation
+//--------------------------------------------------
+
+/**
+ * @brief Create a rotation from a matrix
+ * @param rotation A 3x3 CV_64F rotation matrix (or a 3x4 or 4x4 pose, whose rotation is used)
+ * @return Rotation3d The resultant rotation
+ */
+Rotation3d Rotation3d::FromMat(const Mat& rotation)
+{
+	if (rotation.type() != CV_64F || rotation.rows < 3 || rotation.cols < 3) throw runtime_error("The rotation is expected to be a 3x3 (or larger) CV_64F matrix");
+
+	auto result = Matx33d();
+	for (auto row = 0; row < 3; row++) 
+	{
+		auto input = rotation.ptr<double>(row);
+		for (auto column = 0; column < 3; column++) result.val[row * 3 + column] = input[column];
+	}
+
+	return Rotation3d(result);
+}
+
+/**
+ * @brief Create a rotation from Euler angles, as Rz * Ry * Rx (see PoseUtils::Euler2Matrix)
+ * @param angles The angles about the x, y and z axes (in degrees)
+ * @return Rotation3d The resultant rotation
+ */
+Rotation3d Rotation3d::FromEuler(const Vec3d& angles)
+{
+	auto cx = cos(angles[0] * CV_PI / 180.0); auto sx = sin(angles[0] * CV_PI / 180.0);
+	auto cy = cos(angles[1] * CV_PI / 180.0); auto sy = sin(angles[1] * CV_PI / 180.0);
+	auto cz = cos(angles[2] * CV_PI / 180.0); auto sz = sin(angles[2] * CV_PI / 180.0);
+
+	return Rotation3d(Matx33d(
+		cz * cy, cz * sy * sx - sz * cx, cz * sy * cx + sz * sx,
+		sz * cy, sz * sy * sx + cz * cx, sz * sy * cx - cz * sx,
+		-sy, cy * sx, cy * cx));
+}
+
+/**
+ * @brief Create a rotation from a rotation vector (the closed form of Rodrigues' formula)
+ * @param rvec The axis of rotation, scaled by the angle (in radians)
+ * @return Rotation3d The resultant rotation
+ */
+Rotation3d Rotation3d::FromVector(const Vec3d& rvec)
+{
+	auto theta = sqrt(rvec[0] * rvec[0] + rvec[1] * rvec[1] + rvec[2] * rvec[2]);
+
+	if (theta < 1e-12) return Rotation3d(Matx33d(1, -rvec[2], rvec[1], rvec[2], 1, -rvec[0], -rvec[1], rvec[0], 1));
+
+	auto x = rvec[0] / theta; auto y = rvec[1] / theta; auto z = rvec[2] / theta;
+	auto c = cos(theta); auto s = sin(theta); auto t = 1 - c;
+
+	return Rotation3d(Matx33d(
+		c + t * x * x, t * x * y - s * z, t * x * z + s * y,
+		t * x * y + s * z, c + t * y * y, t * y * z - s * x,
+		t * x * z - s * y, t * y * z + s * x, c + t * z * z));
+}
+
+/**
+ * @brief Create a rotation from a quaternion (see PoseUtils::Quaternion2Matrix)
+ * @param quaternion The unit quaternion (w, x, y, z)
+ * @return Rotation3d The resultant rotation
+ */
+Rotation3d Rotation3d::FromQuaternion(const Vec4d& quaternion)
+{
+	auto& q = quaternion;
+
+	return Rotation3d(Matx33d(
+		1 - 2 * q[2] * q[2] - 2 * q[3] * q[3], 2 * q[1] * q[2] - 2 * q[0] * q[3], 2 * q[1] * q[3] + 2 * q[0] * q[2],
+		2 * q[1] * q[2] + 2 * q[0] * q[3], 1 - 2 * q[1] * q[1] - 2 * q[3] * q[3], 2 * q[2] * q[3] - 2 * q[0] * q[1],
+		2 * q[1] * q[3] - 2 * q[0] * q[2], 2 * q[2] * q[3] + 2 * q[0] * q[1], 1 - 2 * q[1] * q[1] - 2 * q[2] * q[2]));
+}
+
+//--------------------------------------------------
+// Conversion
+//--------------------------------------------------
+
+/**
+ * @brief Convert the rotation into a rotation vector (the inverse of FromVector)
+ * @return Vec3d The axis of rotation, scaled by the angle (in radians)
+ */
+Vec3d Rotation3d::ToVector() const
+{
+	auto& R = _matrix.val;
+
+	auto c = max(-1.0, min(1.0, (R[0] + R[4] + R[8] - 1) * 0.5));
+	auto w = Vec3d(R[7] - R[5], R[2] - R[6], R[3] - R[1]);
+	auto s = 0.5 * sqrt(w[0] * w[0] + w[1] * w[1] + w[2] * w[2]);
+
+	if (s > 1e-6) { auto scale = atan2(s, c) / (2 * s); return Vec3d(w[0] * scale, w[1] * scale, w[2] * scale); }
+	if (c > 0) return Vec3d(w[0] * 0.5, w[1] * 0.5, w[2] * 0.5);
+
+	// The angle is close to pi, so the axis is found from the symmetric part of the matrix
+	auto i = R[0] >= R[4] && R[0] >= R[8] ? 0 : (R[4] >= R[8] ? 1 : 2);
+	auto j = (i + 1) % 3; auto k = (i + 2) % 3;
+
+	auto axis = Vec3d();
+	axis[i] = sqrt(max(0.0, (R[i * 4] - c) / (1 - c)));
+	axis[j] = (R[i * 3 + j] + R[j * 3 + i]) / (2 * (1 - c) * axis[i]);
+	axis[k] = (R[i * 3 + k] + R[k * 3 + i]) / (2 * (1 - c) * axis[i]);
+
+	auto theta = atan2(s, c);
+	return Vec3d(axis[0] * theta, axis[1] * theta, axis[2] * theta);
+}
+
+/**
+ * @brief Convert the rotation into Euler angles (see PoseUtils::Matrix2Euler)
+ * @return Vec3d The angles about the x, y and z axes (in degrees)
+ */
+Vec3d Rotation3d::ToEuler() const
+{
+	auto& R = _matrix.val;
+	auto sy = sqrt(R[0] * R[0] + R[3] * R[3]);
+
+	double x, y, z;
+	if (sy >= 1e-6) { x = atan2(R[7], R[8]); y = atan2(-R[6], sy); z = atan2(R[3], R[0]); }
+	else { x = atan2(-R[5], R[4]); y = atan2(-R[6], sy); z = 0; }
+
+	return Vec3d(x * 180.0 / CV_PI, y * 180.0 / CV_PI, z * 180.0 / CV_PI);
+}
+
+/**
+ * @brief Convert the rotation into a quaternion (see PoseUtils::Matrix2Quaternion)
+ * @return Vec4d The unit quaternion (w, x, y, z)
+ */
+Vec4d Rotation3d::ToQuaternion() const
+{
+	auto& R = _matrix.val;
+	auto trace = R[0] + R[4] + R[8];
+	auto Q = Vec4d();
+
+	if (trace > 0.0)
+	{
+		auto s = sqrt(trace + 1.0);
+		Q[3] = s * 0.5; s = 0.5 / s;
+		Q[0] = (R[7] - R[5]) * s; Q[1] = (R[2] - R[6]) * s; Q[2] = (R[3] - R[1]) * s;
+	}
+	else
+	{
+		auto i = R[0] < R[4] ? (R[4] < R[8] ? 2 : 1) : (R[0] < R[8] ? 2 : 0);
+		auto j = (i + 1) % 3; auto k = (i + 2) % 3;
+
+		auto s = sqrt(R[i * 4] - R[j * 4] - R[k * 4] + 1.0);
+		Q[i] = s * 0.5; s = 0.5 / s;
+		Q[3] = (R[k * 3 + j] - R[j * 3 + k]) * s;
+		Q[j] = (R[j * 3 + i] + R[i * 3 + j]) * s;
+		Q[k] = (R[k * 3 + i] + R[i * 3 + k]) * s;
+	}
+
+	return Vec4d(Q[3], Q[0], Q[1], Q[2]);
+}
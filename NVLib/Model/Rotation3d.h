@@ -0,0 +1,67 @@
+//--------------------------------------------------
+// Model: A fixed size 3D rotation, held on the stack so that it can be used within tight loops
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+namespace NVLib
+{
+	class Rotation3d
+	{
+	private:
+		Matx33d _matrix;
+	public:
+		Rotation3d() : _matrix(Matx33d::eye()) {}
+		explicit Rotation3d(const Matx33d& matrix) : _matrix(matrix) {}
+
+		static Rotation3d FromMat(const Mat& rotation);
+		static Rotation3d FromEuler(const Vec3d& angles);
+		static Rotation3d FromVector(const Vec3d& rvec);
+		static Rotation3d FromQuaternion(const Vec4d& quaternion);
+
+		Vec3d ToVector() const;
+		Vec3d ToEuler() const;
+		Vec4d ToQuaternion() const;
+
+		inline Point3d Apply(const Point3d& point) const 
+		{
+			auto& R = _matrix.val;
+			return Point3d(R[0] * point.x + R[1] * point.y + R[2] * point.z, R[3] * point.x + R[4] * point.y + R[5] * point.z, R[6] * point.x + R[7] * point.y + R[8] * point.z);
+		}
+
+		inline Vec3d Apply(const Vec3d& vector) const 
+		{
+			auto& R = _matrix.val;
+			return Vec3d(R[0] * vector[0] + R[1] * vector[1] + R[2] * vector[2], R[3] * vector[0] + R[4] * vector[1] + R[5] * vector[2], R[6] * vector[0] + R[7] * vector[1] + R[8] * vector[2]);
+		}
+
+		inline Rotation3d operator*(const Rotation3d& other) const 
+		{
+			auto result = Matx33d(); auto& A = _matrix.val; auto& B = other._matrix.val;
+			for (auto row = 0; row < 3; row++) for (auto column = 0; column < 3; column++) 
+			{
+				result.val[row * 3 + column] = A[row * 3] * B[column] + A[row * 3 + 1] * B[3 + column] + A[row * 3 + 2] * B[6 + column];
+			}
+			return Rotation3d(result);
+		}
+
+		inline Rotation3d Inverse() const 
+		{
+			auto& R = _matrix.val;
+			return Rotation3d(Matx33d(R[0], R[3], R[6], R[1], R[4], R[7], R[2], R[5], R[8]));
+		}
+
+		inline const Matx33d& GetMatrix() const { return _matrix; }
+		inline double operator()(int row, int column) const { return _matrix.val[row * 3 + column]; }
+	};
+}
@@ -16,7 +16,7 @@ using namespace NVLib;
 /**
  * @brief Default Constructor
  */
-Scene::Scene()
+Scene::Scene() : _flattened(nullptr)
 {
 	// Extra implementation can go here
 }
@@ -27,6 +27,7 @@ Scene::Scene()
 Scene::~Scene()
 {
 	for (auto& model : _models) delete model;
+	delete _flattened;
 }
 
 //--------------------------------------------------
@@ -34,13 +35,135 @@ Scene::~Scene()
 //--------------------------------------------------
 
 /**
- * @brief Add a new model to the scene
+ * @brief Add a new model to the scene, along with an instance of it. The scene takes ownership of the model and
+ * its vertices are left in model coordinates (the pose is applied when the scene is flattened or exported).
  * @param model The 3D model that we are adding
  * @param pose The pose of the model given the coordinate space of the scene
+ * @return int The identifier of the new instance
  */
-void Scene::AddModel(Model * model, Mat& pose)
+int Scene::AddModel(Model * model, Mat& pose)
 {
-	model->Transform(pose); _models.push_back(model);
+	auto modelId = AddModel(model);
+	return AddInstance(modelId, pose);
+}
+
+/**
+ * @brief Add a new model to the scene without placing it. The scene takes ownership of the model.
+ * @param model The 3D model that we are adding
+ * @return int The identifier of the model (for use with AddInstance)
+ */
+int Scene::AddModel(Model * model)
+{
+	_models.push_back(model);
+	return (int)_models.size() - 1;
+}
+
+/**
+ * @brief Place another copy of a model within the scene. The vertices are shared with the other instances.
+ * @param modelId The identifier of the model (see AddModel)
+ * @param pose The pose of the instance given the coordinate space of the scene
+ * @return int The identifier of the new instance
+ */
+int Scene::AddInstance(int modelId, Mat& pose)
+{
+	if (modelId < 0 || modelId >= (int)_models.size()) throw runtime_error("The model identifier is out of range");
+
+	_instances.push_back(SceneInstance(modelId, GetPose(pose)));
+	Invalidate();
+
+	return (int)_instances.size() - 1;
+}
+
+/**
+ * @brief Move an instance within the scene
+ * @param instanceId The identifier of the instance
+ * @param pose The new pose of the instance given the coordinate space of the scene
+ */
+void Scene::SetPose(int instanceId, Mat& pose)
+{
+	if (instanceId < 0 || instanceId >= (int)_instances.size()) throw runtime_error("The instance identifier is out of range");
+
+	_instances[instanceId].SetPose(GetPose(pose));
+	Invalidate();
+}
+
+//--------------------------------------------------
+// Flatten
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve a model that holds the vertices of every instance in scene coordinates. The model is built on
+ * first use and cached until an instance is added or moved. It remains owned by the scene.
+ * @return Model* The flattened model
+ */
+Model * Scene::GetFlattened()
+{
+	if (_flattened != nullptr) return _flattened;
+
+	auto offsets = vector<int>(_instances.size() + 1, 0);
+	for (auto i = 0; i < (int)_instances.size(); i++) offsets[i + 1] = offsets[i] + GetInstanceModel(i)->VertexCount();
+
+	_flattened = new Model(); _flattened->Resize(offsets.back());
+	double * outX; double * outY; double * outZ; Vec3b * outColors; _flattened->EditVertices(outX, outY, outZ, outColors);
+
+	for (auto i = 0; i < (int)_instances.size(); i++)
+	{
+		auto model = GetInstanceModel(i); auto P = _instances[i].GetPose().val; auto offset = offsets[i];
+		auto x = model->GetX().data(); auto y = model->GetY().data(); auto z = model->GetZ().data();
+		auto colors = model->GetColors().data();
+
+		parallel_for_(cv::Range(0, model->VertexCount()), [&](const cv::Range& range)
+		{
+			for (auto j = range.start; j < range.end; j++)
+			{
+				outX[offset + j] = P[0] * x[j] + P[1] * y[j] + P[2] * z[j] + P[3];
+				outY[offset + j] = P[4] * x[j] + P[5] * y[j] + P[6] * z[j] + P[7];
+				outZ[offset + j] = P[8] * x[j] + P[9] * y[j] + P[10] * z[j] + P[11];
+				outColors[offset + j] = colors[j];
+			}
+		});
+	}
+
+	return _flattened;
+}
+
+/**
+ * @brief Retrieve the scene location of a single vertex of an instance
+ * @param instanceId The identifier of the instance
+ * @param vertex The index of the vertex within the model
+ * @return Point3d The location in scene coordinates
+ */
+Point3d Scene::GetLocation(int instanceId, int vertex)
+{
+	auto location = GetInstanceModel(instanceId)->GetLocation(vertex);
+	auto& P = _instances[instanceId].GetPose();
+	return Point3d(
+		P(0, 0) * location.x + P(0, 1) * location.y + P(0, 2) * location.z + P(0, 3),
+		P(1, 0) * location.x + P(1, 1) * location.y + P(1, 2) * location.z + P(1, 3),
+		P(2, 0) * location.x + P(2, 1) * location.y + P(2, 2) * location.z + P(2, 3));
+}
+
+/**
+ * @brief Retrieve the axis aligned bounds of an instance in scene coordinates (the cached model bounds, moved by the 
+ * instance pose)
+ * @param instanceId The identifier of the instance
+ * @return Vec6d The bounds (xmin, xmax, ymin, ymax, zmin, zmax)
+ */
+Vec6d Scene::GetInstanceBounds(int instanceId)
+{
+	auto bounds = GetInstanceModel(instanceId)->GetBounds();
+	auto& P = _instances[instanceId].GetPose();
+
+	auto result = Vec6d(DBL_MAX, -DBL_MAX, DBL_MAX, -DBL_MAX, DBL_MAX, -DBL_MAX);
+
+	for (auto corner = 0; corner < 8; corner++)
+	{
+		auto x = bounds[(corner & 1) ? 1 : 0]; auto y = bounds[(corner & 2) ? 3 : 2]; auto z = bounds[(corner & 4) ? 5 : 4];
+		auto point = P * Vec4d(x, y, z, 1);
+		for (auto i = 0; i < 3; i++) { result[i * 2] = min(result[i * 2], point[i]); result[i * 2 + 1] = max(result[i * 2 + 1], point[i]); }
+	}
+
+	return result;
 }
 
 //--------------------------------------------------
@@ -48,13 +171,13 @@ void Scene::AddModel(Model * model, Mat& pose)
 //--------------------------------------------------
 
 /**
- * @brief Retrieve the number of vertices that have been added
+ * @brief Retrieve the number of vertices across all the instances
  * @return int Returns a int
  */
 int Scene::VertexCount()
 {
 	auto result = 0;
-	for (auto& model : _models) result += model->VertexCount();
+	for (auto& instance : _instances) result += _models[instance.GetModelId()]->VertexCount();
 	return result;
 }
 
@@ -65,4 +188,39 @@ int Scene::VertexCount()
 int Scene::ModelCount()
 {
 	return (int) _models.size();
-}
\ No newline at end of file
+}
+
+/**
+ * @brief The number of instances that have been placed within the scene
+ * @return int Returns a int
+ */
+int Scene::InstanceCount()
+{
+	return (int) _instances.size();
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Discard the cached flattened model
+ */
+void Scene::Invalidate()
+{
+	delete _flattened; _flattened = nullptr;
+}
+
+/**
+ * @brief Convert a 3x4 or 4x4 pose into a 4x4 matrix
+ * @param pose The pose that we are converting
+ * @return Matx44d The resultant matrix
+ */
+Matx44d Scene::GetPose(Mat& pose)
+{
+	if (pose.type() != CV_64F || pose.total() < 12) throw runtime_error("The pose is expected to be a 3x4 or 4x4 CV_64F matrix");
+
+	auto result = Matx44d::eye(); auto data = (double *)pose.data;
+	for (auto i = 0; i < 12; i++) result.val[i] = data[i];
+	return result;
+}
@@ -13,6 +13,7 @@
 using namespace std;
 
 #include "Model.h"
+#include "SceneInstance.h"
 
 namespace NVLib
 {
@@ -20,15 +21,30 @@ namespace NVLib
 	{
 		private:
 			vector<Model *> _models;
+			vector<SceneInstance> _instances;
+			Model * _flattened;
 		public:
 			Scene();
 			~Scene();
 
-			void AddModel(Model * model, Mat& pose);
+			int AddModel(Model * model, Mat& pose);
+			int AddModel(Model * model);
+			int AddInstance(int modelId, Mat& pose);
+			void SetPose(int instanceId, Mat& pose);
+
+			Model * GetFlattened();
+			Point3d GetLocation(int instanceId, int vertex);
+			Vec6d GetInstanceBounds(int instanceId);
 
 			int VertexCount();
 			int ModelCount();
+			int InstanceCount();
 
 			inline vector<Model *>& GetModels() { return _models; }
+			inline const vector<SceneInstance>& GetInstances() { return _instances; }
+			inline Model * GetInstanceModel(int instanceId) { return _models[_instances[instanceId].GetModelId()]; }
+		private:
+			void Invalidate();
+			static Matx44d GetPose(Mat& pose);
 	};
 }
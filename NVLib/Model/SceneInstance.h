@@ -0,0 +1,31 @@
+//--------------------------------------------------
+// Model: A placement of a shared model within a scene
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+namespace NVLib
+{
+	class SceneInstance
+	{
+	private:
+		int _modelId;
+		Matx44d _pose;
+	public:
+		SceneInstance(int modelId, const Matx44d& pose) : _modelId(modelId), _pose(pose) {}
+
+		inline int GetModelId() const { return _modelId; }
+		inline const Matx44d& GetPose() const { return _pose; }
+		inline void SetPose(const Matx44d& pose) { _pose = pose; }
+	};
+}
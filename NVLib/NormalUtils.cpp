@@ -0,0 +1,213 @@
+//--------------------------------------------------
+// Implementation code for NormalUtils
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "NormalUtils.h"
+using namespace NVLib;
+
+// The number of channels in the integral image: count, x, y, z, xx, xy, xz, yy, yz, zz
+#define INTEGRAL_CHANNELS 10
+
+//--------------------------------------------------
+// Get Normals
+//--------------------------------------------------
+
+/**
+ * @brief Estimate the normals of an organized cloud from its neighbouring pixels
+ * @param colorCloud The organized CV_64FC(6) cloud (pixels with Z == 0 are skipped)
+ * @param normals The resultant CV_32FC3 normal map (zero for pixels without a normal), oriented towards the camera
+ * @param radius The half width of the covariance window (0 uses central differences)
+ */
+void NormalUtils::GetNormals(Mat& colorCloud, Mat& normals, int radius)
+{
+	if (radius <= 0) GetCentralNormals(colorCloud, normals);
+	else GetCovarianceNormals(colorCloud, normals, radius);
+}
+
+//--------------------------------------------------
+// Central Differences
+//--------------------------------------------------
+
+/**
+ * @brief Estimate normals as the cross product of the horizontal and vertical central differences. If a
+ * neighbour is invalid, the one-sided difference is used instead.
+ * @param colorCloud The organized CV_64FC(6) cloud (pixels with Z == 0 are skipped)
+ * @param normals The resultant CV_32FC3 normal map, oriented towards the camera
+ */
+void NormalUtils::GetCentralNormals(Mat& colorCloud, Mat& normals)
+{
+	if (colorCloud.type() != CV_64FC(6)) throw runtime_error("The color cloud is expected to be of type CV_64FC(6)");
+
+	normals = Mat::zeros(colorCloud.size(), CV_32FC3);
+
+	parallel_for_(cv::Range(0, colorCloud.rows), [&](const cv::Range& range)
+	{
+		for (auto row = range.start; row < range.end; row++)
+		{
+			auto center = colorCloud.ptr<double>(row);
+			auto above = row > 0 ? colorCloud.ptr<double>(row - 1) : nullptr;
+			auto below = row + 1 < colorCloud.rows ? colorCloud.ptr<double>(row + 1) : nullptr;
+			auto output = normals.ptr<float>(row);
+
+			for (auto column = 0; column < colorCloud.cols; column++)
+			{
+				auto point = center + column * 6;
+				if (point[2] == 0) continue;
+
+				auto left = column > 0 ? point - 6 : nullptr; auto right = column + 1 < colorCloud.cols ? point + 6 : nullptr;
+				auto up = above != nullptr ? above + column * 6 : nullptr; auto down = below != nullptr ? below + column * 6 : nullptr;
+
+				auto dx = Vec3d(); auto dy = Vec3d();
+				if (!GetDifference(left, point, right, dx) || !GetDifference(up, point, down, dy)) continue;
+
+				auto normal = dx.cross(dy);
+				Orient(point, normal, output + column * 3);
+			}
+		}
+	});
+}
+
+//--------------------------------------------------
+// Covariance
+//--------------------------------------------------
+
+/**
+ * @brief Estimate normals as the smallest eigenvector of the covariance of the valid points within a square
+ * window. The window sums are looked up from an integral image, so the cost does not depend on the radius.
+ * @param colorCloud The organized CV_64FC(6) cloud (pixels with Z == 0 are skipped)
+ * @param normals The resultant CV_32FC3 normal map, oriented towards the camera
+ * @param radius The half width of the window
+ */
+void NormalUtils::GetCovarianceNormals(Mat& colorCloud, Mat& normals, int radius)
+{
+	if (colorCloud.type() != CV_64FC(6)) throw runtime_error("The color cloud is expected to be of type CV_64FC(6)");
+	if (radius <= 0) throw runtime_error("The covariance window radius must be positive");
+
+	Mat integral; BuildIntegral(colorCloud, integral);
+	normals = Mat::zeros(colorCloud.size(), CV_32FC3);
+
+	parallel_for_(cv::Range(0, colorCloud.rows), [&](const cv::Range& range)
+	{
+		for (auto row = range.start; row < range.end; row++)
+		{
+			auto input = colorCloud.ptr<double>(row);
+			auto output = normals.ptr<float>(row);
+			auto top = integral.ptr<double>(max(row - radius, 0));
+			auto bottom = integral.ptr<double>(min(row + radius + 1, colorCloud.rows));
+
+			for (auto column = 0; column < colorCloud.cols; column++)
+			{
+				auto point = input + column * 6;
+				if (point[2] == 0) continue;
+
+				auto left = max(column - radius, 0) * INTEGRAL_CHANNELS;
+				auto right = min(column + radius + 1, colorCloud.cols) * INTEGRAL_CHANNELS;
+
+				double sums[INTEGRAL_CHANNELS];
+				for (auto i = 0; i < INTEGRAL_CHANNELS; i++) sums[i] = bottom[right + i] - bottom[left + i] - top[right + i] + top[left + i];
+				if (sums[0] < 3) continue;
+
+				auto n = sums[0];
+				auto mean = Vec3d(sums[1] / n, sums[2] / n, sums[3] / n);
+				auto covariance = Matx33d(
+					sums[4] / n - mean[0] * mean[0], sums[5] / n - mean[0] * mean[1], sums[6] / n - mean[0] * mean[2],
+					sums[5] / n - mean[0] * mean[1], sums[7] / n - mean[1] * mean[1], sums[8] / n - mean[1] * mean[2],
+					sums[6] / n - mean[0] * mean[2], sums[8] / n - mean[1] * mean[2], sums[9] / n - mean[2] * mean[2]);
+
+				auto values = Vec3d(); auto vectors = Matx33d();
+				Math3D::GetEigenSymmetric(covariance, values, vectors);
+
+				auto normal = Vec3d(vectors(2, 0), vectors(2, 1), vectors(2, 2));
+				Orient(point, normal, output + column * 3);
+			}
+		}
+	});
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Build the (rows + 1) x (cols + 1) integral image of the point moments. Rows are summed in parallel
+ * and then the columns are summed in parallel.
+ * @param colorCloud The cloud that we are building the integral image for
+ * @param integral The resultant CV_64FC(10) integral image
+ */
+void NormalUtils::BuildIntegral(Mat& colorCloud, Mat& integral)
+{
+	integral = Mat::zeros(colorCloud.rows + 1, colorCloud.cols + 1, CV_64FC(INTEGRAL_CHANNELS));
+
+	parallel_for_(cv::Range(0, colorCloud.rows), [&](const cv::Range& range)
+	{
+		for (auto row = range.start; row < range.end; row++)
+		{
+			auto input = colorCloud.ptr<double>(row);
+			auto output = integral.ptr<double>(row + 1);
+
+			for (auto column = 0; column < colorCloud.cols; column++)
+			{
+				auto point = input + column * 6;
+				auto previous = output + column * INTEGRAL_CHANNELS; auto current = previous + INTEGRAL_CHANNELS;
+				for (auto i = 0; i < INTEGRAL_CHANNELS; i++) current[i] = previous[i];
+				if (point[2] == 0) continue;
+
+				auto x = point[0]; auto y = point[1]; auto z = point[2];
+				current[0] += 1; current[1] += x; current[2] += y; current[3] += z;
+				current[4] += x * x; current[5] += x * y; current[6] += x * z;
+				current[7] += y * y; current[8] += y * z; current[9] += z * z;
+			}
+		}
+	});
+
+	auto width = (colorCloud.cols + 1) * INTEGRAL_CHANNELS;
+
+	parallel_for_(cv::Range(0, width), [&](const cv::Range& range)
+	{
+		for (auto row = 1; row <= colorCloud.rows; row++)
+		{
+			auto previous = integral.ptr<double>(row - 1); auto current = integral.ptr<double>(row);
+			for (auto i = range.start; i < range.end; i++) current[i] += previous[i];
+		}
+	});
+}
+
+/**
+ * @brief Find the difference across a point, using the central difference where possible
+ * @param before The point before the center (nullptr if outside the image)
+ * @param center The center point
+ * @param after The point after the center (nullptr if outside the image)
+ * @param difference The resultant difference
+ * @return bool False if neither neighbour is valid
+ */
+bool NormalUtils::GetDifference(const double * before, const double * center, const double * after, Vec3d& difference)
+{
+	auto hasBefore = before != nullptr && before[2] != 0;
+	auto hasAfter = after != nullptr && after[2] != 0;
+	if (!hasBefore && !hasAfter) return false;
+
+	auto first = hasBefore ? before : center; auto last = hasAfter ? after : center;
+	difference = Vec3d(last[0] - first[0], last[1] - first[1], last[2] - first[2]);
+	return true;
+}
+
+/**
+ * @brief Normalize a normal, flip it to face the camera and write it to the normal map
+ * @param point The point that the normal belongs to
+ * @param normal The normal that we are writing
+ * @param output The location within the normal map
+ */
+void NormalUtils::Orient(const double * point, Vec3d& normal, float * output)
+{
+	auto length = sqrt(normal.dot(normal));
+	if (length <= 0) return;
+	if (normal[0] * point[0] + normal[1] * point[1] + normal[2] * point[2] > 0) length = -length;
+
+	output[0] = (float)(normal[0] / length);
+	output[1] = (float)(normal[1] / length);
+	output[2] = (float)(normal[2] / length);
+}
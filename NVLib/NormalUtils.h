@@ -0,0 +1,32 @@
+//--------------------------------------------------
+// A set of utilities for estimating the surface normals of organized clouds
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "Math3D.h"
+
+namespace NVLib
+{
+	class NormalUtils
+	{
+	public:
+		static void GetNormals(Mat& colorCloud, Mat& normals, int radius = 0);
+		static void GetCentralNormals(Mat& colorCloud, Mat& normals);
+		static void GetCovarianceNormals(Mat& colorCloud, Mat& normals, int radius);
+	private:
+		static void BuildIntegral(Mat& colorCloud, Mat& integral);
+		static bool GetDifference(const double * before, const double * center, const double * after, Vec3d& difference);
+		static void Orient(const double * point, Vec3d& normal, float * output);
+	};
+}
@@ -0,0 +1,568 @@
+//--------------------------------------------------
+// Implementation of class PlyReader
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "PlyReader.h"
+using namespace NVLib;
+
+#if !defined(_WIN32)
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+#endif
+
+#include <fstream>
+#include <sstream>
+
+// The minimum number of bytes in an ascii chunk that is parsed by a single work item
+#define MIN_CHUNK_SIZE (1 << 20)
+
+// The minimum number of binary vertices that are read by a single work item
+#define MIN_BLOCK_SIZE 65536
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor: maps the file into memory and parses the header
+ * @param path The path of the file that we are reading
+ */
+PlyReader::PlyReader(const string& path) : _path(path), _data(nullptr), _size(0), _bodyStart(0), _binary(false), _bigEndian(false)
+{
+	OpenFile();
+
+	try 
+	{
+		ParseHeader();
+	}
+	catch (...) 
+	{
+		CloseFile(); throw;
+	}
+}
+
+/**
+ * @brief Main Terminator
+ */
+PlyReader::~PlyReader()
+{
+	CloseFile();
+}
+
+//--------------------------------------------------
+// Read
+//--------------------------------------------------
+
+/**
+ * @brief Read the requested vertex properties. Properties that were not requested are skipped, 
+ * while requested properties that are not in the file are left as zero.
+ * @param names The names of the properties that we want
+ * @param output A (vertex count x names) CV_64F matrix of the property values
+ */
+void PlyReader::ReadProperties(const vector<string>& names, Mat& output)
+{
+	auto elementId = FindVertices(); auto& element = _elements[elementId];
+
+	output = Mat_<double>::zeros((int)element.Count, (int)names.size());
+	if (element.Count == 0 || names.empty()) return;
+
+	auto data = (double *)output.data; auto stride = (int64)names.size();
+	ReadVertices(elementId, names, [data, stride](int64 item, int column, double value) { data[item * stride + column] = value; });
+}
+
+/**
+ * @brief Read the vertices as a dense (vertex count x 1) CV_64FC(6) cloud, holding (X, Y, Z, B, G, R)
+ * @return Mat The resultant cloud
+ */
+Mat PlyReader::ReadCloud()
+{
+	Mat values; ReadProperties(vector<string> { "x", "y", "z", "blue", "green", "red" }, values);
+	return values.reshape(6, values.rows);
+}
+
+/**
+ * @brief Read the vertices into a model. Colors are held in the order that SaveUtils::SaveModel expects. The values
+ * are written straight into the vertex arrays of the model, without an intermediate matrix.
+ * @return Model * The resultant model
+ */
+Model * PlyReader::ReadModel()
+{
+	auto elementId = FindVertices();
+
+	auto result = new Model(); result->Resize((int)_elements[elementId].Count);
+	double * x; double * y; double * z; Vec3b * colors; result->EditVertices(x, y, z, colors);
+	double * locations[] = { x, y, z };
+
+	try 
+	{
+		ReadVertices(elementId, vector<string> { "x", "y", "z", "blue", "green", "red" }, [&](int64 item, int column, double value) 
+		{
+			if (column < 3) locations[column][item] = value;
+			else colors[item][column - 3] = saturate_cast<uchar>((int)value);
+		});
+	}
+	catch (...) 
+	{
+		delete result; throw;
+	}
+
+	return result;
+}
+
+//--------------------------------------------------
+// Retrieve
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve the number of vertices within the file
+ * @return int64 The number of vertices
+ */
+int64 PlyReader::GetVertexCount()
+{
+	auto elementId = FindElement("vertex");
+	return elementId < 0 ? 0 : _elements[elementId].Count;
+}
+
+/**
+ * @brief Determine whether the vertices have the given property
+ * @param name The name of the property
+ * @return bool True if the property was found
+ */
+bool PlyReader::HasProperty(const string& name)
+{
+	auto elementId = FindElement("vertex");
+	if (elementId < 0) return false;
+
+	for (auto& property : _elements[elementId].Properties) if (property.Name == name) return true;
+	return false;
+}
+
+//--------------------------------------------------
+// File Mapping
+//--------------------------------------------------
+
+/**
+ * @brief Map the file into memory (on Windows the file is read into a buffer instead)
+ */
+void PlyReader::OpenFile()
+{
+#if defined(_WIN32)
+	auto reader = ifstream(_path, ios::in | ios::binary | ios::ate);
+	if (!reader.is_open()) throw runtime_error("Unable to open file: " + _path);
+	_fallback.resize((size_t)reader.tellg()); reader.seekg(0);
+	reader.read(_fallback.data(), _fallback.size());
+	_data = _fallback.data(); _size = _fallback.size();
+#else
+	auto handle = open(_path.c_str(), O_RDONLY);
+	if (handle < 0) throw runtime_error("Unable to open file: " + _path);
+
+	struct stat info; 
+	if (fstat(handle, &info) != 0 || info.st_size == 0) { close(handle); throw runtime_error("Unable to read file: " + _path); }
+
+	auto data = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, handle, 0);
+	close(handle);
+	if (data == MAP_FAILED) throw runtime_error("Unable to map file: " + _path);
+
+	madvise(data, (size_t)info.st_size, MADV_SEQUENTIAL);
+	_data = (const char *)data; _size = (size_t)info.st_size;
+#endif
+}
+
+/**
+ * @brief Release the mapping of the file
+ */
+void PlyReader::CloseFile()
+{
+#if !defined(_WIN32)
+	if (_data != nullptr) munmap((void *)_data, _size);
+#endif
+	_data = nullptr; _size = 0; _fallback.clear();
+}
+
+//--------------------------------------------------
+// Header
+//--------------------------------------------------
+
+/**
+ * @brief Parse the header of the file, building the element and property layout
+ */
+void PlyReader::ParseHeader()
+{
+	auto position = (size_t)0; auto lineNumber = 0;
+
+	while (true)
+	{
+		if (position >= _size) throw runtime_error("Unable to find the end of the PLY header: " + _path);
+
+		auto end = position; while (end < _size && _data[end] != '\n') end++;
+		auto line = string(_data + position, end - position);
+		if (!line.empty() && line.back() == '\r') line.pop_back();
+		position = end + 1;
+
+		auto parser = stringstream(line); auto keyword = string(); parser >> keyword;
+
+		if (lineNumber++ == 0) 
+		{
+			if (keyword != "ply") throw runtime_error("The file is not a PLY file: " + _path);
+			continue;
+		}
+
+		if (keyword == "end_header") break;
+		else if (keyword == "format")
+		{
+			auto format = string(); parser >> format;
+			if (format == "ascii") { _binary = false; }
+			else if (format == "binary_little_endian") { _binary = true; _bigEndian = false; }
+			else if (format == "binary_big_endian") { _binary = true; _bigEndian = true; }
+			else throw runtime_error("Unknown PLY format: " + format);
+		}
+		else if (keyword == "element")
+		{
+			auto element = PlyElement(); parser >> element.Name >> element.Count; element.Stride = 0;
+			if (parser.fail()) throw runtime_error("Invalid element definition: " + line);
+			_elements.push_back(element);
+		}
+		else if (keyword == "property")
+		{
+			if (_elements.empty()) throw runtime_error("Property defined outside of an element: " + line);
+			auto& element = _elements.back();
+
+			auto property = PlyProperty(); auto type = string(); parser >> type;
+			property.IsList = type == "list";
+			property.CountType = PlyType::UInt8;
+			property.Offset = element.Stride;
+
+			if (property.IsList) 
+			{
+				auto countType = string(); parser >> countType >> type;
+				property.CountType = GetType(countType);
+			}
+
+			property.Type = GetType(type); parser >> property.Name;
+			if (parser.fail()) throw runtime_error("Invalid property definition: " + line);
+
+			// A stride of -1 indicates that the element has a variable size
+			if (property.IsList || element.Stride < 0) element.Stride = -1;
+			else element.Stride += GetTypeSize(property.Type);
+
+			element.Properties.push_back(property);
+		}
+	}
+
+	_bodyStart = position;
+}
+
+/**
+ * @brief Find the index of the given element
+ * @param name The name of the element
+ * @return int The index of the element or -1 if it was not found
+ */
+int PlyReader::FindElement(const string& name)
+{
+	for (auto i = 0; i < (int)_elements.size(); i++) if (_elements[i].Name == name) return i;
+	return -1;
+}
+
+//--------------------------------------------------
+// Vertices
+//--------------------------------------------------
+
+/**
+ * @brief Find the vertex element
+ * @return int The index of the vertex element
+ */
+int PlyReader::FindVertices()
+{
+	auto elementId = FindElement("vertex");
+	if (elementId < 0) throw runtime_error("The file does not contain any vertices: " + _path);
+	return elementId;
+}
+
+/**
+ * @brief Read the requested vertex properties, handing each value to a sink
+ * @param elementId The index of the vertex element
+ * @param names The names of the properties that we want
+ * @param sink A function (item, column, value) that stores a value, where the column indexes the names
+ */
+template <typename S> void PlyReader::ReadVertices(int elementId, const vector<string>& names, const S& sink)
+{
+	auto& element = _elements[elementId];
+	if (element.Count == 0 || names.empty()) return;
+
+	// Map each property of the element to the output column that it is written to
+	auto columns = vector<int>(element.Properties.size(), -1);
+	for (auto i = 0; i < (int)element.Properties.size(); i++)
+	{
+		for (auto j = 0; j < (int)names.size(); j++) if (element.Properties[i].Name == names[j]) columns[i] = j;
+	}
+
+	if (_binary) ReadBinary(element, FindBinaryStart(elementId), columns, sink);
+	else ReadAscii(elementId, columns, sink);
+}
+
+//--------------------------------------------------
+// Binary
+//--------------------------------------------------
+
+/**
+ * @brief Find where the data of an element starts within a binary file
+ * @param elementId The index of the element
+ * @return size_t The offset of the data in the file
+ */
+size_t PlyReader::FindBinaryStart(int elementId)
+{
+	auto position = _bodyStart;
+
+	for (auto i = 0; i < elementId; i++)
+	{
+		auto& element = _elements[i];
+		if (element.Stride >= 0) { position += (size_t)element.Count * element.Stride; continue; }
+
+		for (int64 item = 0; item < element.Count; item++)
+		{
+			for (auto& property : element.Properties)
+			{
+				if (position + GetTypeSize(property.IsList ? property.CountType : property.Type) > _size) throw runtime_error("Unexpected end of file: " + _path);
+				if (!property.IsList) { position += GetTypeSize(property.Type); continue; }
+
+				auto count = (size_t)GetValue(_data + position, property.CountType, _bigEndian);
+				position += GetTypeSize(property.CountType) + count * GetTypeSize(property.Type);
+			}
+		}
+	}
+
+	return position;
+}
+
+/**
+ * @brief Read the requested properties of a binary element. Fixed size elements are read in parallel blocks.
+ * @param element The element that we are reading
+ * @param start The offset of the element data within the file
+ * @param columns The output column of each property (-1 if the property is skipped)
+ * @param sink A function (item, column, value) that stores a value
+ */
+template <typename S> void PlyReader::ReadBinary(PlyElement& element, size_t start, const vector<int>& columns, const S& sink)
+{
+	if (element.Stride < 0)
+	{
+		// Variable sized elements need to be walked in order
+		auto position = start;
+		for (int64 item = 0; item < element.Count; item++)
+		{
+			for (auto i = 0; i < (int)element.Properties.size(); i++)
+			{
+				auto& property = element.Properties[i];
+				if (position + GetTypeSize(property.IsList ? property.CountType : property.Type) > _size) throw runtime_error("Unexpected end of file: " + _path);
+
+				if (property.IsList)
+				{
+					auto count = (size_t)GetValue(_data + position, property.CountType, _bigEndian);
+					position += GetTypeSize(property.CountType) + count * GetTypeSize(property.Type);
+					continue;
+				}
+
+				if (columns[i] >= 0) sink(item, columns[i], GetValue(_data + position, property.Type, _bigEndian));
+				position += GetTypeSize(property.Type);
+			}
+		}
+		return;
+	}
+
+	if (start + (size_t)element.Count * element.Stride > _size) throw runtime_error("Unexpected end of file: " + _path);
+
+	auto blockCount = (int)max((int64)1, element.Count / MIN_BLOCK_SIZE);
+
+	parallel_for_(cv::Range(0, blockCount), [&](const cv::Range& range)
+	{
+		for (auto block = range.start; block < range.end; block++)
+		{
+			auto first = element.Count * block / blockCount;
+			auto last = element.Count * (block + 1) / blockCount;
+
+			for (auto item = first; item < last; item++)
+			{
+				auto vertex = _data + start + (size_t)item * element.Stride;
+
+				for (auto i = 0; i < (int)columns.size(); i++)
+				{
+					if (columns[i] < 0) continue;
+					auto& property = element.Properties[i];
+					sink(item, columns[i], GetValue(vertex + property.Offset, property.Type, _bigEndian));
+				}
+			}
+		}
+	});
+}
+
+//--------------------------------------------------
+// Ascii
+//--------------------------------------------------
+
+/**
+ * @brief Read the requested properties of an ascii element. The body is split into chunks that are 
+ * aligned to line boundaries, the lines in each chunk are counted in parallel, and then each chunk
+ * parses the lines that belong to the element.
+ * @param elementId The index of the element that we are reading
+ * @param columns The output column of each property (-1 if the property is skipped)
+ * @param sink A function (item, column, value) that stores a value
+ */
+template <typename S> void PlyReader::ReadAscii(int elementId, const vector<int>& columns, const S& sink)
+{
+	auto& element = _elements[elementId];
+
+	// Each element item takes up a single line
+	int64 firstLine = 0; for (auto i = 0; i < elementId; i++) firstLine += _elements[i].Count;
+	auto lastLine = firstLine + element.Count;
+
+	// Split the body into chunks that start at the beginning of a line
+	auto bodySize = _size - _bodyStart;
+	auto chunkCount = (int)max((size_t)1, min(bodySize / MIN_CHUNK_SIZE, (size_t)getNumberOfCPUs() * 4));
+
+	auto bounds = vector<size_t>(chunkCount + 1);
+	bounds[0] = _bodyStart; bounds[chunkCount] = _size;
+	for (auto i = 1; i < chunkCount; i++)
+	{
+		auto position = max(bounds[i - 1], _bodyStart + bodySize * i / chunkCount);
+		while (position < _size && _data[position - 1] != '\n') position++;
+		bounds[i] = position;
+	}
+
+	// Count the lines within each chunk
+	auto lineCounts = vector<int64>(chunkCount + 1, 0);
+	parallel_for_(cv::Range(0, chunkCount), [&](const cv::Range& range)
+	{
+		for (auto chunk = range.start; chunk < range.end; chunk++)
+		{
+			lineCounts[chunk + 1] = count(_data + bounds[chunk], _data + bounds[chunk + 1], '\n');
+		}
+	});
+	for (auto i = 1; i <= chunkCount; i++) lineCounts[i] += lineCounts[i - 1];
+	if (lineCounts[chunkCount] + 1 < lastLine) throw runtime_error("Unexpected end of file: " + _path);
+
+	// Parse the lines that belong to the element
+	parallel_for_(cv::Range(0, chunkCount), [&](const cv::Range& range)
+	{
+		for (auto chunk = range.start; chunk < range.end; chunk++)
+		{
+			auto line = lineCounts[chunk];
+			if (line >= lastLine || lineCounts[chunk + 1] < firstLine) continue;
+
+			auto position = _data + bounds[chunk]; auto end = _data + bounds[chunk + 1];
+
+			for (; position < end && line < lastLine; line++)
+			{
+				auto lineEnd = (const char *)memchr(position, '\n', end - position);
+				if (lineEnd == nullptr) lineEnd = end;
+
+				if (line >= firstLine)
+				{
+					auto item = line - firstLine; auto cursor = position; auto value = 0.0;
+
+					for (auto i = 0; i < (int)element.Properties.size(); i++)
+					{
+						cursor = ParseValue(cursor, lineEnd, value);
+
+						if (element.Properties[i].IsList) 
+						{
+							auto count = (int)value;
+							for (auto j = 0; j < count; j++) cursor = ParseValue(cursor, lineEnd, value);
+						}
+						else if (columns[i] >= 0) sink(item, columns[i], value);
+					}
+				}
+
+				position = lineEnd + 1;
+			}
+		}
+	});
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Convert a PLY type name into a type
+ * @param name The name of the type
+ * @return PlyType The resultant type
+ */
+PlyType PlyReader::GetType(const string& name)
+{
+	if (name == "char" || name == "int8") return PlyType::Int8;
+	if (name == "uchar" || name == "uint8") return PlyType::UInt8;
+	if (name == "short" || name == "int16") return PlyType::Int16;
+	if (name == "ushort" || name == "uint16") return PlyType::UInt16;
+	if (name == "int" || name == "int32") return PlyType::Int32;
+	if (name == "uint" || name == "uint32") return PlyType::UInt32;
+	if (name == "float" || name == "float32") return PlyType::Float32;
+	if (name == "double" || name == "float64") return PlyType::Float64;
+	throw runtime_error("Unknown PLY type: " + name);
+}
+
+/**
+ * @brief Retrieve the size of the given type in bytes
+ * @param type The type that we are getting the size of
+ * @return int The size in bytes
+ */
+int PlyReader::GetTypeSize(PlyType type)
+{
+	switch (type)
+	{
+		case PlyType::Int8: case PlyType::UInt8: return 1;
+		case PlyType::Int16: case PlyType::UInt16: return 2;
+		case PlyType::Int32: case PlyType::UInt32: case PlyType::Float32: return 4;
+		default: return 8;
+	}
+}
+
+/**
+ * @brief Read a binary value as a double
+ * @param data The location of the value
+ * @param type The type of the value
+ * @param swap Indicates whether the byte order needs to be swapped
+ * @return double The resultant value
+ */
+double PlyReader::GetValue(const char * data, PlyType type, bool swap)
+{
+	char bytes[8]; auto size = GetTypeSize(type);
+	if (swap) for (auto i = 0; i < size; i++) bytes[i] = data[size - 1 - i];
+	else memcpy(bytes, data, size);
+
+	switch (type)
+	{
+		case PlyType::Int8: return *(schar *)bytes;
+		case PlyType::UInt8: return *(uchar *)bytes;
+		case PlyType::Int16: { int16_t value; memcpy(&value, bytes, 2); return value; }
+		case PlyType::UInt16: { uint16_t value; memcpy(&value, bytes, 2); return value; }
+		case PlyType::Int32: { int32_t value; memcpy(&value, bytes, 4); return value; }
+		case PlyType::UInt32: { uint32_t value; memcpy(&value, bytes, 4); return value; }
+		case PlyType::Float32: { float value; memcpy(&value, bytes, 4); return value; }
+		default: { double value; memcpy(&value, bytes, 8); return value; }
+	}
+}
+
+/**
+ * @brief Parse the next ascii value on a line
+ * @param data The current position within the line
+ * @param end The end of the line
+ * @param value The value that was parsed
+ * @return const char * The position after the value
+ */
+const char * PlyReader::ParseValue(const char * data, const char * end, double& value)
+{
+	while (data < end && (*data == ' ' || *data == '\t' || *data == '\r')) data++;
+
+	char token[64]; auto length = 0;
+	while (data < end && *data != ' ' && *data != '\t' && *data != '\r' && length < 63) token[length++] = *data++;
+	if (length == 0) throw runtime_error("Unexpected end of line within PLY file");
+	token[length] = 0;
+
+	value = strtod(token, nullptr);
+	return data;
+}
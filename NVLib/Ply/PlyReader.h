@@ -0,0 +1,83 @@
+//--------------------------------------------------
+// Utility: A memory mapped reader for PLY point files
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "../Model/Model.h"
+
+namespace NVLib
+{
+	enum class PlyType { Int8, UInt8, Int16, UInt16, Int32, UInt32, Float32, Float64 };
+
+	struct PlyProperty
+	{
+		string Name;
+		PlyType Type;
+		bool IsList;
+		PlyType CountType;
+		int Offset;
+	};
+
+	struct PlyElement
+	{
+		string Name;
+		int64 Count;
+		vector<PlyProperty> Properties;
+		int Stride;
+	};
+
+	class PlyReader
+	{
+	private:
+		string _path;
+		const char * _data;
+		size_t _size;
+		size_t _bodyStart;
+		bool _binary;
+		bool _bigEndian;
+		vector<PlyElement> _elements;
+		vector<char> _fallback;
+	public:
+		PlyReader(const string& path);
+		PlyReader(const PlyReader& other) = delete;
+		PlyReader& operator=(const PlyReader& other) = delete;
+		~PlyReader();
+
+		void ReadProperties(const vector<string>& names, Mat& output);
+		Mat ReadCloud();
+		Model * ReadModel();
+
+		int64 GetVertexCount();
+		bool HasProperty(const string& name);
+
+		inline bool IsBinary() { return _binary; }
+		inline vector<PlyElement>& GetElements() { return _elements; }
+	private:
+		void OpenFile();
+		void CloseFile();
+		void ParseHeader();
+		int FindElement(const string& name);
+		int FindVertices();
+		size_t FindBinaryStart(int elementId);
+		template <typename S> void ReadVertices(int elementId, const vector<string>& names, const S& sink);
+		template <typename S> void ReadBinary(PlyElement& element, size_t start, const vector<int>& columns, const S& sink);
+		template <typename S> void ReadAscii(int elementId, const vector<int>& columns, const S& sink);
+
+		static PlyType GetType(const string& name);
+		static int GetTypeSize(PlyType type);
+		static double GetValue(const char * data, PlyType type, bool swap);
+		static const char * ParseValue(const char * data, const char * end, double& value);
+	};
+}
@@ -0,0 +1,209 @@
+//--------------------------------------------------
+// Implementation of class PlyStreamWriter
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "PlyStreamWriter.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor. Memory use is bounded by two buffers of the given size: one that is being filled
+ * by the caller and one that is being written to disk by the background thread.
+ * @param path The path of the file that we are writing to
+ * @param binary Indicates whether a binary_little_endian file is written (otherwise ascii)
+ * @param doublePrecision Indicates whether locations and normals are written as doubles (otherwise floats)
+ * @param hasNormals Indicates whether each vertex has a normal
+ * @param bufferSize The size of each of the two buffers
+ */
+PlyStreamWriter::PlyStreamWriter(const string& path, bool binary, bool doublePrecision, bool hasNormals, size_t bufferSize) :
+	_binary(binary), _doublePrecision(doublePrecision), _hasNormals(hasNormals), _vertexCount(0),
+	_activeUsed(0), _pendingUsed(0), _pendingFull(false), _stopping(false)
+{
+	_writer.open(path, ios::out | ios::binary);
+	if (!_writer.is_open()) throw runtime_error("Unable to open file: " + path);
+
+	_countPosition = PlyWriter::WriteHeader(_writer, binary, doublePrecision, hasNormals);
+
+	_active.resize(max(bufferSize, PlyWriter::MAX_VERTEX_SIZE));
+	_pending.resize(_active.size());
+
+	_thread = thread(&PlyStreamWriter::WriteLoop, this);
+}
+
+/**
+ * @brief Main Terminator
+ */
+PlyStreamWriter::~PlyStreamWriter()
+{
+	try { Close(); } catch (const exception&) { /* Errors are reported by an explicit call to Close() */ }
+}
+
+//--------------------------------------------------
+// Update
+//--------------------------------------------------
+
+/**
+ * @brief Add a vertex to the file
+ * @param location The location of the vertex
+ * @param color The color of the vertex in the order (red, green, blue)
+ */
+void PlyStreamWriter::AddVertex(const Point3d& location, const Vec3i& color)
+{
+	AddVertex(location, Vec3d(), color);
+}
+
+/**
+ * @brief Add a vertex to the file
+ * @param location The location of the vertex
+ * @param normal The normal of the vertex (ignored if the writer was not created with normals)
+ * @param color The color of the vertex in the order (red, green, blue)
+ */
+void PlyStreamWriter::AddVertex(const Point3d& location, const Vec3d& normal, const Vec3i& color)
+{
+	if (_active.size() - _activeUsed < PlyWriter::MAX_VERTEX_SIZE) Submit();
+
+	_activeUsed += PlyWriter::Encode(&_active[_activeUsed], _active.size() - _activeUsed, _binary, _doublePrecision, _hasNormals, location, normal, color);
+	_vertexCount++;
+}
+
+/**
+ * @brief Add the valid (Z != 0) points of a color cloud
+ * @param colorCloud The CV_64FC(6) cloud holding (X, Y, Z, B, G, R)
+ */
+void PlyStreamWriter::AddCloud(Mat& colorCloud)
+{
+	Mat normals; AddCloud(colorCloud, normals);
+}
+
+/**
+ * @brief Add the valid (Z != 0) points of a color cloud, along with their normals
+ * @param colorCloud The CV_64FC(6) cloud holding (X, Y, Z, B, G, R)
+ * @param normals A normal map (CV_32FC3 or CV_64FC3) of the same size as the cloud, or an empty Mat for no normals
+ */
+void PlyStreamWriter::AddCloud(Mat& colorCloud, Mat& normals)
+{
+	if (colorCloud.type() != CV_64FC(6)) throw runtime_error("The color cloud is expected to be of type CV_64FC(6)");
+	auto hasNormals = !normals.empty();
+	if (hasNormals && normals.size() != colorCloud.size()) throw runtime_error("The normal map needs to be the same size as the cloud");
+	if (hasNormals && normals.type() != CV_32FC3 && normals.type() != CV_64FC3) throw runtime_error("The normal map is expected to be of type CV_32FC3 or CV_64FC3");
+
+	for (auto row = 0; row < colorCloud.rows; row++)
+	{
+		auto cloudRow = colorCloud.ptr<double>(row);
+
+		for (auto column = 0; column < colorCloud.cols; column++)
+		{
+			auto point = cloudRow + column * 6;
+			if (point[2] == 0) continue;
+
+			auto location = Point3d(point[0], point[1], point[2]);
+			auto color = Vec3i((int)point[5], (int)point[4], (int)point[3]);
+			auto normal = Vec3d();
+			if (hasNormals) normal = normals.depth() == CV_32F ? Vec3d(normals.ptr<Vec3f>(row)[column]) : normals.ptr<Vec3d>(row)[column];
+
+			AddVertex(location, normal, color);
+		}
+	}
+}
+
+/**
+ * @brief Add the vertices of a model
+ * @param model The model that we are adding
+ */
+void PlyStreamWriter::AddModel(Model * model)
+{
+	auto& x = model->GetX(); auto& y = model->GetY(); auto& z = model->GetZ(); auto& colors = model->GetColors();
+
+	for (auto i = 0; i < model->VertexCount(); i++)
+	{
+		AddVertex(Point3d(x[i], y[i], z[i]), Vec3i(colors[i][2], colors[i][1], colors[i][0]));
+	}
+}
+
+/**
+ * @brief Write the outstanding data, stop the background thread, patch the vertex count and close the file
+ */
+void PlyStreamWriter::Close()
+{
+	if (!_thread.joinable()) return;
+
+	// Any error is only reported once the thread has been joined, so that the writer can always be destroyed
+	TrySubmit();
+
+	{
+		unique_lock<mutex> lock(_mutex);
+		_stopping = true;
+		_condition.notify_all();
+	}
+
+	_thread.join();
+
+	if (_error.empty()) PlyWriter::PatchCount(_writer, _countPosition, _vertexCount);
+	if (_error.empty() && !_writer.good()) _error = "Failed to write to the PLY file";
+
+	_writer.close();
+	if (_error.empty() && _writer.fail()) _error = "Failed to write to the PLY file";
+
+	if (!_error.empty()) throw runtime_error(_error);
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Hand the active buffer to the background thread, reporting an earlier write failure
+ */
+void PlyStreamWriter::Submit()
+{
+	if (!TrySubmit()) throw runtime_error(_error);
+}
+
+/**
+ * @brief Hand the active buffer to the background thread. If the thread is still writing the previous buffer,
+ * then this waits for it to finish, which is what bounds the memory use.
+ * @return bool False if an earlier write failed (in which case the buffer is dropped)
+ */
+bool PlyStreamWriter::TrySubmit()
+{
+	unique_lock<mutex> lock(_mutex);
+	_condition.wait(lock, [&] { return !_pendingFull; });
+	if (!_error.empty()) { _activeUsed = 0; return false; }
+	if (_activeUsed == 0) return true;
+
+	_active.swap(_pending); _pendingUsed = _activeUsed; _activeUsed = 0;
+	_pendingFull = true;
+	_condition.notify_all();
+
+	return true;
+}
+
+/**
+ * @brief The body of the background thread, which writes each submitted buffer to disk
+ */
+void PlyStreamWriter::WriteLoop()
+{
+	while (true)
+	{
+		unique_lock<mutex> lock(_mutex);
+		_condition.wait(lock, [&] { return _pendingFull || _stopping; });
+		if (!_pendingFull) return;
+		lock.unlock();
+
+		// The caller does not touch the pending buffer until it has been marked as written
+		_writer.write(&_pending[0], _pendingUsed);
+		auto failed = !_writer.good();
+
+		lock.lock();
+		if (failed && _error.empty()) _error = "Failed to write to the PLY file";
+		_pendingFull = false;
+		_condition.notify_all();
+	}
+}
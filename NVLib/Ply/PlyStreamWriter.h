@@ -0,0 +1,67 @@
+//--------------------------------------------------
+// Utility: A PLY point writer that streams batches of points to disk on a background thread
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <fstream>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "../Model/Model.h"
+#include "PlyWriter.h"
+
+namespace NVLib
+{
+	class PlyStreamWriter
+	{
+	private:
+		ofstream _writer;
+		bool _binary;
+		bool _doublePrecision;
+		bool _hasNormals;
+		int64 _vertexCount;
+		streampos _countPosition;
+
+		vector<char> _active;
+		size_t _activeUsed;
+		vector<char> _pending;
+		size_t _pendingUsed;
+		bool _pendingFull;
+		bool _stopping;
+		string _error;
+
+		mutex _mutex;
+		condition_variable _condition;
+		thread _thread;
+	public:
+		PlyStreamWriter(const string& path, bool binary = true, bool doublePrecision = false, bool hasNormals = false, size_t bufferSize = 1 << 24);
+		~PlyStreamWriter();
+
+		void AddVertex(const Point3d& location, const Vec3i& color);
+		void AddVertex(const Point3d& location, const Vec3d& normal, const Vec3i& color);
+		void AddCloud(Mat& colorCloud);
+		void AddCloud(Mat& colorCloud, Mat& normals);
+		void AddModel(Model * model);
+		void Close();
+
+		inline int64 GetVertexCount() { return _vertexCount; }
+		inline bool IsBinary() { return _binary; }
+		inline bool HasNormals() { return _hasNormals; }
+	private:
+		void Submit();
+		bool TrySubmit();
+		void WriteLoop();
+	};
+}
@@ -0,0 +1,215 @@
+//--------------------------------------------------
+// Implementation of class PlyWriter
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "PlyWriter.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param path The path of the file that we are writing to
+ * @param binary Indicates whether a binary_little_endian file is written (otherwise ascii)
+ * @param doublePrecision Indicates whether locations and normals are written as doubles (otherwise floats)
+ * @param hasNormals Indicates whether each vertex has a normal
+ * @param bufferSize The size of the output buffer
+ */
+PlyWriter::PlyWriter(const string& path, bool binary, bool doublePrecision, bool hasNormals, size_t bufferSize) :
+	_binary(binary), _doublePrecision(doublePrecision), _hasNormals(hasNormals), _bufferUsed(0), _vertexCount(0)
+{
+	_writer.open(path, ios::out | ios::binary);
+	if (!_writer.is_open()) throw runtime_error("Unable to open file: " + path);
+
+	_buffer.resize(max(bufferSize, MAX_VERTEX_SIZE));
+
+	_countPosition = WriteHeader(_writer, binary, doublePrecision, hasNormals);
+}
+
+/**
+ * @brief Main Terminator
+ */
+PlyWriter::~PlyWriter()
+{
+	try { Close(); } catch (const exception&) { /* Errors are reported by an explicit call to Close() */ }
+}
+
+//--------------------------------------------------
+// Update
+//--------------------------------------------------
+
+/**
+ * @brief Add a vertex to the file
+ * @param location The location of the vertex
+ * @param color The color of the vertex in the order (red, green, blue)
+ */
+void PlyWriter::AddVertex(const Point3d& location, const Vec3i& color)
+{
+	AddVertex(location, Vec3d(), color);
+}
+
+/**
+ * @brief Add a vertex to the file
+ * @param location The location of the vertex
+ * @param normal The normal of the vertex (ignored if the writer was not created with normals)
+ * @param color The color of the vertex in the order (red, green, blue)
+ */
+void PlyWriter::AddVertex(const Point3d& location, const Vec3d& normal, const Vec3i& color)
+{
+	if (_buffer.size() - _bufferUsed < MAX_VERTEX_SIZE)
+	{
+		Flush();
+		if (!_writer.good()) throw runtime_error("Failed to write to the PLY file");
+	}
+
+	_bufferUsed += Encode(&_buffer[_bufferUsed], _buffer.size() - _bufferUsed, _binary, _doublePrecision, _hasNormals, location, normal, color);
+	_vertexCount++;
+}
+
+/**
+ * @brief Flush the outstanding data, patch the vertex count within the header and close the file. The file is
+ * always closed, after which a write failure (such as a full disk) is reported.
+ */
+void PlyWriter::Close()
+{
+	if (!_writer.is_open()) return;
+
+	Flush();
+	if (_writer.good()) PatchCount(_writer, _countPosition, _vertexCount);
+
+	auto failed = !_writer.good();
+	_writer.close();
+
+	if (failed || _writer.fail()) throw runtime_error("Failed to write to the PLY file");
+}
+
+//--------------------------------------------------
+// Encoding
+//--------------------------------------------------
+
+/**
+ * @brief Write the header. The vertex count is left as a fixed width placeholder that is patched on close, 
+ * so that the points can be written in a single pass.
+ * @param writer The stream that we are writing to
+ * @param binary Indicates whether the file is binary_little_endian (otherwise ascii)
+ * @param doublePrecision Indicates whether locations and normals are doubles (otherwise floats)
+ * @param hasNormals Indicates whether each vertex has a normal
+ * @return streampos The position of the vertex count placeholder
+ */
+streampos PlyWriter::WriteHeader(ostream& writer, bool binary, bool doublePrecision, bool hasNormals)
+{
+	auto type = doublePrecision ? "double" : "float";
+
+	writer << "ply" << endl;
+	writer << (binary ? "format binary_little_endian 1.0" : "format ascii 1.0") << endl;
+	writer << "comment Generated by Neural Vision Ltd" << endl;
+	writer << "element vertex ";
+	auto countPosition = writer.tellp();
+	writer << string(COUNT_WIDTH, ' ') << endl;
+	writer << "property " << type << " x" << endl;
+	writer << "property " << type << " y" << endl;
+	writer << "property " << type << " z" << endl;
+
+	if (hasNormals)
+	{
+		writer << "property " << type << " nx" << endl;
+		writer << "property " << type << " ny" << endl;
+		writer << "property " << type << " nz" << endl;
+	}
+
+	writer << "property uchar red" << endl;
+	writer << "property uchar green" << endl;
+	writer << "property uchar blue" << endl;
+	writer << "end_header" << endl;
+
+	return countPosition;
+}
+
+/**
+ * @brief Overwrite the vertex count placeholder within the header
+ * @param writer The stream that we are writing to
+ * @param countPosition The position of the placeholder (see WriteHeader)
+ * @param vertexCount The number of vertices that were written
+ */
+void PlyWriter::PatchCount(ostream& writer, streampos countPosition, int64 vertexCount)
+{
+	char count[COUNT_WIDTH + 1];
+	snprintf(count, sizeof(count), "%-*lld", COUNT_WIDTH, (long long)vertexCount);
+	writer.seekp(countPosition);
+	writer.write(count, COUNT_WIDTH);
+}
+
+/**
+ * @brief Encode a vertex in the layout described by WriteHeader. Ascii values are written with a bounded number of
+ * significant digits, so that any vertex (even 1e300 or NaN) fits within MAX_VERTEX_SIZE bytes.
+ * @param output The location that we are writing to
+ * @param space The number of bytes available at the output (at least MAX_VERTEX_SIZE)
+ * @param binary Indicates whether the vertex is binary_little_endian (otherwise ascii)
+ * @param doublePrecision Indicates whether locations and normals are doubles (otherwise floats)
+ * @param hasNormals Indicates whether the normal is written
+ * @param location The location of the vertex
+ * @param normal The normal of the vertex
+ * @param color The color of the vertex in the order (red, green, blue)
+ * @return size_t The number of bytes that were written
+ */
+size_t PlyWriter::Encode(char * output, size_t space, bool binary, bool doublePrecision, bool hasNormals, const Point3d& location, const Vec3d& normal, const Vec3i& color)
+{
+	if (binary)
+	{
+		auto start = output;
+
+		if (doublePrecision)
+		{
+			Append(output, location.x); Append(output, location.y); Append(output, location.z);
+			if (hasNormals) { Append(output, normal[0]); Append(output, normal[1]); Append(output, normal[2]); }
+		}
+		else
+		{
+			Append(output, (float)location.x); Append(output, (float)location.y); Append(output, (float)location.z);
+			if (hasNormals) { Append(output, (float)normal[0]); Append(output, (float)normal[1]); Append(output, (float)normal[2]); }
+		}
+
+		Append(output, (uchar)color[0]); Append(output, (uchar)color[1]); Append(output, (uchar)color[2]);
+
+		return (size_t)(output - start);
+	}
+
+	auto format = doublePrecision ? "%.17g %.17g %.17g " : "%.9g %.9g %.9g ";
+
+	auto length = snprintf(output, space, format, location.x, location.y, location.z);
+	if (hasNormals) length += snprintf(output + length, space - length, format, normal[0], normal[1], normal[2]);
+	length += snprintf(output + length, space - length, "%i %i %i\n", color[0], color[1], color[2]);
+
+	return (size_t)length;
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Write the contents of the buffer to disk
+ */
+void PlyWriter::Flush()
+{
+	if (_bufferUsed == 0) return;
+	_writer.write(&_buffer[0], _bufferUsed);
+	_bufferUsed = 0;
+}
+
+/**
+ * @brief Append a binary value to an output location (binary_little_endian assumes a little endian host)
+ * @param output The location that we are writing to (moved past the value)
+ * @param value The value that we are appending
+ */
+template <typename T> void PlyWriter::Append(char *& output, T value)
+{
+	memcpy(output, &value, sizeof(T));
+	output += sizeof(T);
+}
@@ -0,0 +1,57 @@
+//--------------------------------------------------
+// Utility: A buffered writer for PLY point files
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <fstream>
+#include <vector>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+namespace NVLib
+{
+	class PlyWriter
+	{
+	private:
+		ofstream _writer;
+		bool _binary;
+		bool _doublePrecision;
+		bool _hasNormals;
+		vector<char> _buffer;
+		size_t _bufferUsed;
+		int64 _vertexCount;
+		streampos _countPosition;
+	public:
+		// The width reserved in the header for the vertex count, which is patched on close
+		static constexpr int COUNT_WIDTH = 20;
+
+		// The largest number of bytes that a single encoded vertex can take up
+		static constexpr size_t MAX_VERTEX_SIZE = 256;
+
+		PlyWriter(const string& path, bool binary = false, bool doublePrecision = false, bool hasNormals = false, size_t bufferSize = 1 << 22);
+		~PlyWriter();
+
+		void AddVertex(const Point3d& location, const Vec3i& color);
+		void AddVertex(const Point3d& location, const Vec3d& normal, const Vec3i& color);
+		void Close();
+
+		inline int64 GetVertexCount() { return _vertexCount; }
+		inline bool IsBinary() { return _binary; }
+		inline bool HasNormals() { return _hasNormals; }
+
+		static streampos WriteHeader(ostream& writer, bool binary, bool doublePrecision, bool hasNormals);
+		static void PatchCount(ostream& writer, streampos countPosition, int64 vertexCount);
+		static size_t Encode(char * output, size_t space, bool binary, bool doublePrecision, bool hasNormals, const Point3d& location, const Vec3d& normal, const Vec3i& color);
+	private:
+		void Flush();
+		template <typename T> static void Append(char *& output, T value);
+	};
+}
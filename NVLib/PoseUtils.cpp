@@ -19,21 +19,7 @@ using namespace NVLib;
  */
 Mat PoseUtils::Vectors2Pose(const Vec3d & rvec, const Vec3d & tvec) 
 {
-	Mat result = Mat::eye(4, 4, CV_64FC1); auto data = (double*)result.data;
-	Mat rotation; Rodrigues(rvec, rotation);
-
-	auto rData = (double*)rotation.data;
-	for (auto row = 0; row < 3; row++)
-	{
-		for (auto column = 0; column < 3; column++)
-		{
-			data[column + row * 4] = rData[column + row * 3];
-		}
-	}
-
-	data[3] = tvec[0]; data[7] = tvec[1]; data[11] = tvec[2];
-
-	return result;
+	return Pose3d::FromVectors(rvec, tvec).ToMat();
 }
 
 //--------------------------------------------------
@@ -48,20 +34,19 @@ Mat PoseUtils::Vectors2Pose(const Vec3d & rvec, const Vec3d & tvec)
  */
 void PoseUtils::Pose2Vectors(Mat& pose, Vec3d & rvec, Vec3d & tvec) 
 {
-	Mat rotation = Mat(3, 3, CV_64FC1);
-	auto pdata = (double*)pose.data; auto rdata = (double*)rotation.data;
-
-	for (auto row = 0; row < 3; row++) 
-	{
-		for (auto column = 0; column < 4; column++) 
-		{
-			auto index = column + row * 4;
-			if (column == 3) tvec[row] = pdata[index];
-			else rdata[column + row * 3] = pdata[index];		
-		}	
-	}
+	Pose2Vectors(Pose3d::FromMat(pose), rvec, tvec);
+}
 
-	Rodrigues(rotation, rvec);
+/**
+ * Convert a fixed size pose into a rotation vector and a translation vector
+ * @param pose The pose that we are converting
+ * @param rvec The rvec that we are updating
+ * @param tvec The tvec that we are updating
+ */
+void PoseUtils::Pose2Vectors(const Pose3d& pose, Vec3d& rvec, Vec3d& tvec)
+{
+	rvec = pose.GetRotation().ToVector();
+	tvec = pose.GetTranslation();
 }
 
 //--------------------------------------------------
@@ -149,36 +134,17 @@ Mat PoseUtils::Quaternion2Matrix(const Vec4d & quaternion)
  */
 Vec4d PoseUtils::Matrix2Quaternion(Mat& R)
 {
-    double trace = R.at<double>(0,0) + R.at<double>(1,1) + R.at<double>(2,2);
-	auto Q = Vec4d();
-
-    if (trace > 0.0) 
-    {
-        double s = sqrt(trace + 1.0);
-        Q[3] = (s * 0.5);
-        s = 0.5 / s;
-        Q[0] = ((R.at<double>(2,1) - R.at<double>(1,2)) * s);
-        Q[1] = ((R.at<double>(0,2) - R.at<double>(2,0)) * s);
-        Q[2] = ((R.at<double>(1,0) - R.at<double>(0,1)) * s);
-    } 
-    
-    else 
-    {
-        int i = R.at<double>(0,0) < R.at<double>(1,1) ? (R.at<double>(1,1) < R.at<double>(2,2) ? 2 : 1) : (R.at<double>(0,0) < R.at<double>(2,2) ? 2 : 0); 
-        int j = (i + 1) % 3;  
-        int k = (i + 2) % 3;
-
-        double s = sqrt(R.at<double>(i, i) - R.at<double>(j,j) - R.at<double>(k,k) + 1.0);
-        Q[i] = s * 0.5;
-        s = 0.5 / s;
-
-        Q[3] = (R.at<double>(k,j) - R.at<double>(j,k)) * s;
-        Q[j] = (R.at<double>(j,i) + R.at<double>(i,j)) * s;
-        Q[k] = (R.at<double>(k,i) + R.at<double>(i,k)) * s;
-    }
-
-	// Return the Q
-	return Vec4d(Q[3], Q[0], Q[1], Q[2]);
+	return Matrix2Quaternion(Rotation3d::FromMat(R));
+}
+
+/**
+ * @brief Converts a fixed size rotation into a quaternion
+ * @param R The rotation that we are converting
+ * @return Return the Quaternion (w, x, y, z)
+ */
+Vec4d PoseUtils::Matrix2Quaternion(const Rotation3d& R)
+{
+	return R.ToQuaternion();
 }
 
 //--------------------------------------------------
@@ -190,32 +156,7 @@ Vec4d PoseUtils::Matrix2Quaternion(Mat& R)
  */
 Mat PoseUtils::Euler2Matrix(const Vec3d & angles) 
 {
-	auto theta = Vec3d(Degree2Radian(angles[0]), Degree2Radian(angles[1]), Degree2Radian(angles[2]));
-
-	// Calculate rotation about x axis
-    Mat R_x = (Mat_<double>(3,3) <<
-               1,       0,              0,
-               0,       cos(theta[0]),   -sin(theta[0]),
-               0,       sin(theta[0]),   cos(theta[0])
-               );
-
-    // Calculate rotation about y axis
-    Mat R_y = (Mat_<double>(3,3) <<
-               cos(theta[1]),    0,      sin(theta[1]),
-               0,               1,      0,
-               -sin(theta[1]),   0,      cos(theta[1])
-               );
-
-    // Calculate rotation about z axis
-    Mat R_z = (Mat_<double>(3,3) <<
-               cos(theta[2]),    -sin(theta[2]),      0,
-               sin(theta[2]),    cos(theta[2]),       0,
-               0,               0,                  1);
-
-    // Combined rotation matrix
-    Mat R = R_z * R_y * R_x;
-
-    return R;
+	return Mat(Rotation3d::FromEuler(angles).GetMatrix());
 }
 
 /**
@@ -225,24 +166,17 @@ Mat PoseUtils::Euler2Matrix(const Vec3d & angles)
  */
 Vec3d PoseUtils::Matrix2Euler(Mat& R) 
 {
-    auto sy = sqrt(R.at<double>(0,0) * R.at<double>(0,0) +  R.at<double>(1,0) * R.at<double>(1,0) );
-
-    bool singular = sy < 1e-6; // If
-
-    double x, y, z;
-    if (!singular)
-    {
-        x = atan2(R.at<double>(2,1) , R.at<double>(2,2));
-        y = atan2(-R.at<double>(2,0), sy);
-        z = atan2(R.at<double>(1,0), R.at<double>(0,0));
-    }
-    else
-    {
-        x = atan2(-R.at<double>(1,2), R.at<double>(1,1));
-        y = atan2(-R.at<double>(2,0), sy);
-        z = 0;
-    }
-    return Vec3d( Radian2Degree(x), Radian2Degree(y), Radian2Degree(z));
+	return Matrix2Euler(Rotation3d::FromMat(R));
+}
+
+/**
+ * @brief Get Euler angles from a fixed size rotation
+ * @param R The rotation
+ * @return Vec3d The resultant angles (in degrees)
+ */
+Vec3d PoseUtils::Matrix2Euler(const Rotation3d& R)
+{
+	return R.ToEuler();
 }
 
 //--------------------------------------------------
@@ -272,6 +206,17 @@ Mat PoseUtils::GetPose(Mat& rotation, Vec3d& translation)
 	return result;
 }
 
+/**
+ * Build a fixed size pose from a seperate rotation and translation
+ * @param rotation The rotation component
+ * @param translation The translation component
+ * @return Pose3d The resultant pose
+ */
+Pose3d PoseUtils::GetPose(const Rotation3d& rotation, const Vec3d& translation)
+{
+	return Pose3d(rotation, translation);
+}
+
 //--------------------------------------------------
 // Radian and Degree conversions
 //--------------------------------------------------
@@ -18,6 +18,8 @@ using namespace std;
 #include <opencv2/opencv.hpp>
 using namespace cv;
 
+#include "Model/Pose3d.h"
+
 namespace NVLib
 {
 	class PoseUtils
@@ -25,14 +27,18 @@ namespace NVLib
 	public:
 		static Mat Vectors2Pose(const Vec3d & rvec, const Vec3d & tvec);
 		static void Pose2Vectors(Mat & pose, Vec3d & rvec, Vec3d & tvec);
+		static void Pose2Vectors(const Pose3d& pose, Vec3d& rvec, Vec3d& tvec);
 		static Vec3d GetPoseTranslation(Mat& pose);
 		static Mat GetPoseRotation(Mat& pose);
 		static Vec4d NormalizeQuaternion(const Vec4d& quaternion);
 		static Mat Quaternion2Matrix(const Vec4d& quaternion);
 		static Vec4d Matrix2Quaternion(Mat& R);
+		static Vec4d Matrix2Quaternion(const Rotation3d& R);
 		static Mat Euler2Matrix(const Vec3d& angles);
 		static Vec3d Matrix2Euler(Mat& R);
+		static Vec3d Matrix2Euler(const Rotation3d& R);
 		static Mat GetPose(Mat& rotation, Vec3d& translation);
+		static Pose3d GetPose(const Rotation3d& rotation, const Vec3d& translation);
 		static double Degree2Radian(double degrees);
 		static double Radian2Degree(double radians);
 	};
@@ -0,0 +1,341 @@
+//--------------------------------------------------
+// Implementation of class IcpEngine
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "IcpEngine.h"
+using namespace NVLib;
+
+// The number of neighbours used to estimate the normals of an unorganized target
+#define NORMAL_NEIGHBOURS 10
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param metric The error metric that is minimized
+ * @param maxIterations The maximum number of iterations at each level
+ * @param maxDistance The maximum distance between corresponding points
+ * @param minChange The size of pose update (translation + rotation angle) below which a level has converged
+ */
+IcpEngine::IcpEngine(IcpMetric metric, int maxIterations, double maxDistance, double minChange) :
+	_metric(metric), _maxIterations(maxIterations), _maxDistance(maxDistance), _minChange(minChange)
+{
+	_levels = vector<int> { 4, 2, 1 };
+}
+
+//--------------------------------------------------
+// Align
+//--------------------------------------------------
+
+/**
+ * @brief Find the pose that aligns the source cloud with the target cloud. Alignment runs coarse to fine over the
+ * sampling steps in GetLevels(). If a camera matrix has been set and the target is organized, correspondences are
+ * found by projecting into the target image, otherwise they are found with a nearest neighbour search.
+ * @param source The CV_64FC(6) cloud that we are aligning
+ * @param target The CV_64FC(6) cloud that we are aligning to
+ * @param initialPose The initial guess of the pose (3x4 or 4x4)
+ * @return Mat The 4x4 pose that maps source points into the frame of the target (see CloudUtils::TransformCloud)
+ */
+Mat IcpEngine::Align(Mat& source, Mat& target, Mat& initialPose)
+{
+	if (source.type() != CV_64FC(6) || target.type() != CV_64FC(6)) throw runtime_error("The clouds are expected to be of type CV_64FC(6)");
+
+	_history.clear();
+
+	auto pose = Matx44d::eye();
+	auto poseData = (double *)initialPose.data;
+	for (auto i = 0; i < 12; i++) pose.val[i] = poseData[i];
+
+	auto tree = KdTree(target);
+	auto normals = vector<Vec3d>(); if (_metric == IcpMetric::PointToPlane) GetNormals(target, tree, normals);
+
+	auto points = vector<Point3d>(); auto moved = vector<Point3d>(); auto matches = vector<int>();
+
+	for (auto level = 0; level < (int)_levels.size(); level++)
+	{
+		SamplePoints(source, _levels[level], points);
+
+		for (auto iteration = 0; iteration < _maxIterations; iteration++)
+		{
+			auto startTime = getTickCount();
+
+			auto count = Associate(target, tree, points, pose, matches, moved);
+
+			auto update = Matx44d::eye(); auto rmse = 0.0;
+			auto solved = Solve(target, normals, moved, matches, update, rmse);
+			if (solved) pose = update * pose;
+
+			auto milliseconds = (getTickCount() - startTime) * 1000.0 / getTickFrequency();
+			_history.push_back(IcpIteration(level, iteration, count, rmse, milliseconds));
+
+			if (!solved) break;
+
+			// Determine the size of the update (translation + rotation angle)
+			auto trace = update(0, 0) + update(1, 1) + update(2, 2);
+			auto angle = acos(min(1.0, max(-1.0, (trace - 1) * 0.5)));
+			auto translation = sqrt(update(0, 3) * update(0, 3) + update(1, 3) * update(1, 3) + update(2, 3) * update(2, 3));
+			if (angle + translation < _minChange) break;
+		}
+	}
+
+	return Mat(pose, true);
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Sample the valid points of a cloud on a regular grid
+ * @param cloud The cloud that we are sampling
+ * @param step The step between samples (along both the rows and columns of an organized cloud)
+ * @param points The sampled points
+ */
+void IcpEngine::SamplePoints(Mat& cloud, int step, vector<Point3d>& points)
+{
+	points.clear(); step = max(step, 1);
+	auto rowStep = cloud.rows > 1 && cloud.cols > 1 ? step : 1;
+	auto columnStep = cloud.cols > 1 ? step : 1;
+
+	for (auto row = 0; row < cloud.rows; row += rowStep)
+	{
+		auto input = cloud.ptr<double>(row);
+
+		for (auto column = 0; column < cloud.cols; column += columnStep)
+		{
+			auto point = input + column * 6;
+			if (point[2] != 0) points.push_back(Point3d(point[0], point[1], point[2]));
+		}
+	}
+}
+
+/**
+ * @brief Estimate the normals of the target. Organized targets use the image grid (see NormalUtils), otherwise
+ * the normals come from the covariance of the nearest neighbours.
+ * @param target The target cloud
+ * @param tree The search tree of the target
+ * @param normals The normal of each target pixel (zero for invalid pixels), pointing towards the sensor
+ */
+void IcpEngine::GetNormals(Mat& target, KdTree& tree, vector<Vec3d>& normals)
+{
+	normals.assign(target.total(), Vec3d());
+
+	if (target.rows > 1 && target.cols > 1)
+	{
+		Mat normalMap; NormalUtils::GetCovarianceNormals(target, normalMap, 1);
+		for (auto row = 0; row < normalMap.rows; row++)
+		{
+			auto input = normalMap.ptr<Vec3f>(row);
+			for (auto column = 0; column < normalMap.cols; column++) normals[column + row * normalMap.cols] = Vec3d(input[column]);
+		}
+		return;
+	}
+
+	parallel_for_(cv::Range(0, tree.GetSize()), [&](const cv::Range& range)
+	{
+		auto indices = vector<int>(); auto distances = vector<float>();
+
+		for (auto node = range.start; node < range.end; node++)
+		{
+			auto index = tree.GetIndex(node); auto point = GetTargetPoint(target, index);
+			tree.FindNearest(point, NORMAL_NEIGHBOURS, indices, distances);
+			if (indices.size() < 3) continue;
+
+			auto mean = Vec3d();
+			for (auto neighbour : indices) mean += Vec3d(GetTargetPoint(target, neighbour));
+			mean *= 1.0 / indices.size();
+
+			auto covariance = Matx33d::zeros();
+			for (auto neighbour : indices)
+			{
+				auto delta = Vec3d(GetTargetPoint(target, neighbour)) - mean;
+				for (auto i = 0; i < 3; i++) for (auto j = 0; j < 3; j++) covariance(i, j) += delta[i] * delta[j];
+			}
+
+			auto values = Vec3d(); auto vectors = Matx33d();
+			Math3D::GetEigenSymmetric(covariance, values, vectors);
+
+			auto normal = Vec3d(vectors(2, 0), vectors(2, 1), vectors(2, 2));
+			if (normal.dot(Vec3d(point)) > 0) normal = -normal;
+			normals[index] = normal;
+		}
+	});
+}
+
+/**
+ * @brief Find the target point that corresponds to each source point (in parallel)
+ * @param target The target cloud
+ * @param tree The search tree of the target
+ * @param points The sampled source points
+ * @param pose The current estimate of the pose
+ * @param matches The pixel index of the corresponding target point (-1 if there is no match)
+ * @param moved The source points, after they have been moved by the pose
+ * @return int The number of correspondences that were found
+ */
+int IcpEngine::Associate(Mat& target, KdTree& tree, const vector<Point3d>& points, const Matx44d& pose, vector<int>& matches, vector<Point3d>& moved)
+{
+	matches.assign(points.size(), -1); moved.resize(points.size());
+
+	auto projective = !_camera.empty() && target.rows > 1 && target.cols > 1;
+	auto k = projective ? (double *)_camera.data : nullptr;
+	auto P = pose.val; auto maxDistance2 = _maxDistance * _maxDistance;
+
+	parallel_for_(cv::Range(0, (int)points.size()), [&](const cv::Range& range)
+	{
+		for (auto i = range.start; i < range.end; i++)
+		{
+			auto& point = points[i];
+			auto X = P[0] * point.x + P[1] * point.y + P[2] * point.z + P[3];
+			auto Y = P[4] * point.x + P[5] * point.y + P[6] * point.z + P[7];
+			auto Z = P[8] * point.x + P[9] * point.y + P[10] * point.z + P[11];
+			moved[i] = Point3d(X, Y, Z);
+
+			auto index = -1;
+
+			if (projective)
+			{
+				if (Z <= 0) continue;
+				auto u = (int)round(k[0] * X / Z + k[2]); auto v = (int)round(k[4] * Y / Z + k[5]);
+				if (u < 0 || u >= target.cols || v < 0 || v >= target.rows) continue;
+				index = u + v * target.cols;
+				if (target.ptr<double>(v)[u * 6 + 2] == 0) continue;
+			}
+			else
+			{
+				auto distance = 0.0f; index = tree.FindNearest(moved[i], distance);
+				if (index < 0) continue;
+			}
+
+			auto delta = moved[i] - GetTargetPoint(target, index);
+			if (delta.dot(delta) <= maxDistance2) matches[i] = index;
+		}
+	});
+
+	return (int)(matches.size() - count(matches.begin(), matches.end(), -1));
+}
+
+/**
+ * @brief Find the closed form pose update for the current correspondences. The normal equations (or point sums)
+ * are accumulated in parallel stripes and then combined.
+ * @param target The target cloud
+ * @param normals The normals of the target (point-to-plane only)
+ * @param moved The moved source points
+ * @param matches The corresponding target pixel indices
+ * @param update The pose update that is applied on top of the current pose
+ * @param rmse The root mean squared error of the correspondences before the update
+ * @return bool False if there were not enough correspondences to find an update
+ */
+bool IcpEngine::Solve(Mat& target, const vector<Vec3d>& normals, const vector<Point3d>& moved, const vector<int>& matches, Matx44d& update, double& rmse)
+{
+	auto stripeCount = max(1, min(getNumThreads() * 4, (int)moved.size() / 1024 + 1));
+	auto planar = _metric == IcpMetric::PointToPlane;
+
+	// Per stripe sums: the normal equations (point-to-plane) or the point sums (point-to-point)
+	auto A = vector<Matx66d>(stripeCount, Matx66d::zeros()); auto b = vector<Matx61d>(stripeCount, Matx61d::zeros());
+	auto H = vector<Matx33d>(stripeCount, Matx33d::zeros()); auto sourceSums = vector<Vec3d>(stripeCount); auto targetSums = vector<Vec3d>(stripeCount);
+	auto errors = vector<double>(stripeCount, 0); auto counts = vector<int>(stripeCount, 0);
+
+	parallel_for_(cv::Range(0, stripeCount), [&](const cv::Range& range)
+	{
+		for (auto stripe = range.start; stripe < range.end; stripe++)
+		{
+			auto first = (int)((int64)moved.size() * stripe / stripeCount);
+			auto last = (int)((int64)moved.size() * (stripe + 1) / stripeCount);
+
+			for (auto i = first; i < last; i++)
+			{
+				if (matches[i] < 0) continue;
+
+				auto p = Vec3d(moved[i]); auto q = Vec3d(GetTargetPoint(target, matches[i]));
+
+				if (planar)
+				{
+					auto& n = normals[matches[i]];
+					auto residual = (p - q).dot(n);
+					auto c = p.cross(n);
+					double J[] = { c[0], c[1], c[2], n[0], n[1], n[2] };
+
+					for (auto row = 0; row < 6; row++)
+					{
+						for (auto column = 0; column < 6; column++) A[stripe](row, column) += J[row] * J[column];
+						b[stripe](row) -= J[row] * residual;
+					}
+
+					errors[stripe] += residual * residual;
+				}
+				else
+				{
+					for (auto row = 0; row < 3; row++) for (auto column = 0; column < 3; column++) H[stripe](row, column) += p[row] * q[column];
+					sourceSums[stripe] += p; targetSums[stripe] += q;
+					errors[stripe] += (p - q).dot(p - q);
+				}
+
+				counts[stripe]++;
+			}
+		}
+	});
+
+	for (auto stripe = 1; stripe < stripeCount; stripe++)
+	{
+		A[0] = A[0] + A[stripe]; b[0] = b[0] + b[stripe]; H[0] = H[0] + H[stripe];
+		sourceSums[0] += sourceSums[stripe]; targetSums[0] += targetSums[stripe];
+		errors[0] += errors[stripe]; counts[0] += counts[stripe];
+	}
+
+	auto count = counts[0];
+	rmse = count > 0 ? sqrt(errors[0] / count) : 0;
+	if (count < (planar ? 6 : 3)) return false;
+
+	if (planar)
+	{
+		// Solve the linearized system for (rx, ry, rz, tx, ty, tz)
+		Mat x; if (!solve(Mat(A[0]), Mat(b[0]), x, DECOMP_CHOLESKY)) return false;
+		auto values = (double *)x.data;
+		update = PoseUtils::Vectors2Pose(Vec3d(values[0], values[1], values[2]), Vec3d(values[3], values[4], values[5]));
+		return true;
+	}
+
+	// Closed form rigid alignment of the two point sets (Umeyama without scale)
+	auto sourceMean = sourceSums[0] * (1.0 / count); auto targetMean = targetSums[0] * (1.0 / count);
+	auto covariance = H[0] * (1.0 / count);
+	for (auto row = 0; row < 3; row++) for (auto column = 0; column < 3; column++) covariance(row, column) -= sourceMean[row] * targetMean[column];
+
+	Mat w, u, vt; SVD::compute(Mat(covariance), w, u, vt);
+	Matx33d U = u; Matx33d V = Mat(vt.t());
+	auto R = V * U.t();
+
+	if (determinant(R) < 0)
+	{
+		for (auto row = 0; row < 3; row++) V(row, 2) = -V(row, 2);
+		R = V * U.t();
+	}
+
+	auto t = targetMean - R * sourceMean;
+
+	update = Matx44d::eye();
+	for (auto row = 0; row < 3; row++)
+	{
+		for (auto column = 0; column < 3; column++) update(row, column) = R(row, column);
+		update(row, 3) = t[row];
+	}
+
+	return true;
+}
+
+/**
+ * @brief Retrieve a point from the target cloud
+ * @param target The target cloud
+ * @param index The pixel index of the point
+ * @return Point3d The resultant point
+ */
+Point3d IcpEngine::GetTargetPoint(Mat& target, int index)
+{
+	auto point = target.ptr<double>(index / target.cols) + (index % target.cols) * 6;
+	return Point3d(point[0], point[1], point[2]);
+}
@@ -0,0 +1,58 @@
+//--------------------------------------------------
+// A refiner engine that aligns point clouds using ICP
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "../Math3D.h"
+#include "../PoseUtils.h"
+#include "../NormalUtils.h"
+#include "../Spatial/KdTree.h"
+#include "IcpIteration.h"
+
+namespace NVLib
+{
+	enum class IcpMetric { PointToPoint, PointToPlane };
+
+	class IcpEngine
+	{
+	private:
+		IcpMetric _metric;
+		int _maxIterations;
+		double _maxDistance;
+		double _minChange;
+		vector<int> _levels;
+		Mat _camera;
+		vector<IcpIteration> _history;
+	public:
+		IcpEngine(IcpMetric metric = IcpMetric::PointToPlane, int maxIterations = 30, double maxDistance = 0.1, double minChange = 1e-6);
+
+		Mat Align(Mat& source, Mat& target, Mat& initialPose);
+
+		inline IcpMetric& GetMetric() { return _metric; }
+		inline int& GetMaxIterations() { return _maxIterations; }
+		inline double& GetMaxDistance() { return _maxDistance; }
+		inline double& GetMinChange() { return _minChange; }
+		inline vector<int>& GetLevels() { return _levels; }
+		inline Mat& GetCamera() { return _camera; }
+		inline vector<IcpIteration>& GetHistory() { return _history; }
+	private:
+		void SamplePoints(Mat& cloud, int step, vector<Point3d>& points);
+		void GetNormals(Mat& target, KdTree& tree, vector<Vec3d>& normals);
+		int Associate(Mat& target, KdTree& tree, const vector<Point3d>& points, const Matx44d& pose, vector<int>& matches, vector<Point3d>& moved);
+		bool Solve(Mat& target, const vector<Vec3d>& normals, const vector<Point3d>& moved, const vector<int>& matches, Matx44d& update, double& rmse);
+
+		static Point3d GetTargetPoint(Mat& target, int index);
+	};
+}
@@ -0,0 +1,34 @@
+//--------------------------------------------------
+// Model: The statistics of a single ICP iteration
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+namespace NVLib
+{
+	class IcpIteration
+	{
+	private:
+		int _level;
+		int _iteration;
+		int _correspondences;
+		double _rmse;
+		double _milliseconds;
+	public:
+		IcpIteration(int level, int iteration, int correspondences, double rmse, double milliseconds) :
+			_level(level), _iteration(iteration), _correspondences(correspondences), _rmse(rmse), _milliseconds(milliseconds) {}
+
+		inline int GetLevel() { return _level; }
+		inline int GetIteration() { return _iteration; }
+		inline int GetCorrespondences() { return _correspondences; }
+		inline double GetRmse() { return _rmse; }
+		inline double GetMilliseconds() { return _milliseconds; }
+	};
+}
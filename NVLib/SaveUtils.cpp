@@ -17,44 +17,78 @@ using namespace NVLib;
  * @brief Save a model to disk as a PLY file
  * @param path The path that we are saving the model to
  * @param model The model that we are saving
+ * @param binary Indicates whether a binary_little_endian file is written (otherwise ascii)
+ * @param doublePrecision Indicates whether locations are written as doubles (otherwise floats)
  */
-void SaveUtils::SaveModel(const string& path, Model * model)
+void SaveUtils::SaveModel(const string& path, Model * model, bool binary, bool doublePrecision)
 {
-	auto writer = ofstream(path);
-
-	// Write the header
-	writer << "ply" << endl;
-	writer << "format ascii 1.0" << endl;
-	writer << "comment Generated by Neural Vision Ltd" << endl;
-	writer << "element vertex " << model->VertexCount() << endl;
-	writer << "property float x" << endl;
-	writer << "property float y" << endl;
-	writer << "property float z" << endl;
-	writer << "property uchar red" << endl;
-	writer << "property uchar green" << endl;
-	writer << "property uchar blue" << endl;
-	writer << "end_header" << endl;
-
-	// Write the data
-	for (auto& vertex : model->GetVertices()) 
+	auto normals = vector<Vec3d>(); SaveModel(path, model, normals, binary, doublePrecision);
+}
+
+/**
+ * @brief Save a model, along with its normals, to disk as a PLY file
+ * @param path The path that we are saving the model to
+ * @param model The model that we are saving
+ * @param normals The normal of each vertex, or an empty vector for no normals
+ * @param binary Indicates whether a binary_little_endian file is written (otherwise ascii)
+ * @param doublePrecision Indicates whether locations and normals are written as doubles (otherwise floats)
+ */
+void SaveUtils::SaveModel(const string& path, Model * model, vector<Vec3d>& normals, bool binary, bool doublePrecision)
+{
+	auto hasNormals = !normals.empty();
+	if (hasNormals && (int)normals.size() != model->VertexCount()) throw runtime_error("There needs to be a normal for each vertex");
+
+	auto writer = PlyWriter(path, binary, doublePrecision, hasNormals);
+
+	auto& x = model->GetX(); auto& y = model->GetY(); auto& z = model->GetZ(); auto& colors = model->GetColors();
+	for (auto i = 0; i < model->VertexCount(); i++) 
 	{
-		// Retrieve the 3D points
-		auto X = vertex.GetLocation().x;
-		auto Y = vertex.GetLocation().y;
-		auto Z = vertex.GetLocation().z;
-		if (Z == 0) continue;
-
-		// Retrieve the Color points
-		auto R = (int)vertex.GetColor()[0];
-		auto G = (int)vertex.GetColor()[1];
-		auto B = (int)vertex.GetColor()[2];
-
-		// Write the PLY entry
-		char buffer[100];
-		sprintf(buffer, "%f %f %f %i %i %i\n", X, Y, Z, B, G, R);
-		writer.write(buffer, strlen(buffer));
+		if (z[i] == 0) continue;
+
+		auto location = Point3d(x[i], y[i], z[i]);
+		auto fileColor = Vec3i(colors[i][2], colors[i][1], colors[i][0]);
+
+		if (hasNormals) writer.AddVertex(location, normals[i], fileColor);
+		else writer.AddVertex(location, fileColor);
 	}
 	
-	// Close the writer
-	writer.close();
+	writer.Close();
+}
+
+//--------------------------------------------------
+// Save Scene
+//--------------------------------------------------
+
+/**
+ * @brief Save every instance of a scene to disk as a single PLY file. Each instance is transformed as it is 
+ * written, so the scene does not need to be flattened first.
+ * @param path The path that we are saving the scene to
+ * @param scene The scene that we are saving
+ * @param binary Indicates whether a binary_little_endian file is written (otherwise ascii)
+ * @param doublePrecision Indicates whether locations are written as doubles (otherwise floats)
+ */
+void SaveUtils::SaveScene(const string& path, Scene * scene, bool binary, bool doublePrecision)
+{
+	auto writer = PlyWriter(path, binary, doublePrecision);
+
+	for (auto& instance : scene->GetInstances())
+	{
+		auto model = scene->GetModels()[instance.GetModelId()]; auto P = instance.GetPose().val;
+		auto& x = model->GetX(); auto& y = model->GetY(); auto& z = model->GetZ(); auto& colors = model->GetColors();
+
+		for (auto i = 0; i < model->VertexCount(); i++)
+		{
+			auto location = Point3d(
+				P[0] * x[i] + P[1] * y[i] + P[2] * z[i] + P[3],
+				P[4] * x[i] + P[5] * y[i] + P[6] * z[i] + P[7],
+				P[8] * x[i] + P[9] * y[i] + P[10] * z[i] + P[11]);
+
+			// Match SaveModel on the flattened scene, which skips the vertices at Z == 0 in scene coordinates
+			if (location.z == 0) continue;
+
+			writer.AddVertex(location, Vec3i(colors[i][2], colors[i][1], colors[i][0]));
+		}
+	}
+
+	writer.Close();
 }
@@ -16,12 +16,16 @@ using namespace std;
 using namespace cv;
 
 #include "Model/Model.h"
+#include "Model/Scene.h"
+#include "Ply/PlyWriter.h"
 
 namespace NVLib
 {
 	class SaveUtils
 	{
 	public:
-		static void SaveModel(const string& path, Model * model);
+		static void SaveModel(const string& path, Model * model, bool binary = false, bool doublePrecision = false);
+		static void SaveModel(const string& path, Model * model, vector<Vec3d>& normals, bool binary = false, bool doublePrecision = false);
+		static void SaveScene(const string& path, Scene * scene, bool binary = false, bool doublePrecision = false);
 	};
 }
@@ -0,0 +1,278 @@
+//--------------------------------------------------
+// Implementation of class Bvh
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "Bvh.h"
+using namespace NVLib;
+
+// The largest number of items held within a leaf
+#define MAX_LEAF_SIZE 4
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Build the hierarchy over a set of boxes. Results refer to the index of the box.
+ * @param bounds The boxes (xmin, xmax, ymin, ymax, zmin, zmax)
+ */
+Bvh::Bvh(const vector<Vec6d>& bounds) : _bounds(bounds)
+{
+	Build();
+}
+
+/**
+ * @brief Build the hierarchy over the instances of a scene. Results refer to the instance identifier.
+ * The hierarchy needs to be rebuilt if instances are added or moved.
+ * @param scene The scene that we are building the hierarchy for
+ */
+Bvh::Bvh(Scene * scene)
+{
+	_bounds.resize(scene->InstanceCount());
+	for (auto i = 0; i < scene->InstanceCount(); i++) _bounds[i] = scene->GetInstanceBounds(i);
+	Build();
+}
+
+//--------------------------------------------------
+// Queries
+//--------------------------------------------------
+
+/**
+ * @brief Find the items whose boxes may be visible within a frustum
+ * @param frustum The frustum of the camera
+ * @param items The resultant items (ascending order)
+ */
+void Bvh::FindVisible(const Frustum& frustum, vector<int>& items)
+{
+	Find([&](const Vec6d& bounds) { return frustum.IntersectsBox(bounds); }, items);
+}
+
+/**
+ * @brief Find the items whose boxes overlap a range
+ * @param range The box that we are searching (xmin, xmax, ymin, ymax, zmin, zmax)
+ * @param items The resultant items (ascending order)
+ */
+void Bvh::FindRange(const Vec6d& range, vector<int>& items)
+{
+	Find([&](const Vec6d& bounds) { return Overlaps(bounds, range); }, items);
+}
+
+/**
+ * @brief Find the items whose boxes (grown by a radius) are hit by a ray
+ * @param origin The origin of the ray
+ * @param direction The direction of the ray
+ * @param radius The distance that the boxes are grown by
+ * @param items The resultant items, ordered by the distance at which the ray enters their box
+ * @param distances The distance (in units of the direction length) at which the ray enters each box
+ */
+void Bvh::FindRay(const Point3d& origin, const Vec3d& direction, double radius, vector<int>& items, vector<double>& distances)
+{
+	auto inverse = Vec3d();
+	for (auto i = 0; i < 3; i++) inverse[i] = direction[i] != 0 ? 1.0 / direction[i] : DBL_MAX;
+
+	auto hits = vector<int>(); auto distance = 0.0;
+	Find([&](const Vec6d& bounds) { return IntersectsRay(bounds, origin, inverse, radius, distance); }, hits);
+
+	auto entries = vector<pair<double, int>>();
+	for (auto item : hits) { IntersectsRay(_bounds[item], origin, inverse, radius, distance); entries.push_back(make_pair(distance, item)); }
+	sort(entries.begin(), entries.end());
+
+	items.clear(); distances.clear();
+	for (auto& entry : entries) { distances.push_back(entry.first); items.push_back(entry.second); }
+}
+
+/**
+ * @brief Find the vertex of a scene that is closest to the camera along a ray, out of the vertices within a radius
+ * of the ray. Instances are visited in the order that the ray enters their box, so the search stops as soon as the 
+ * remaining boxes are further away than the best vertex.
+ * @param scene The scene that the hierarchy was built from
+ * @param origin The origin of the ray
+ * @param direction The direction of the ray
+ * @param radius The largest distance between the ray and a picked vertex
+ * @param instanceId The instance of the picked vertex
+ * @param vertex The index of the picked vertex within its model
+ * @param distance The distance along the ray to the picked vertex
+ * @return bool True if a vertex was picked
+ */
+bool Bvh::Pick(Scene * scene, const Point3d& origin, const Vec3d& direction, double radius, int& instanceId, int& vertex, double& distance)
+{
+	auto unit = Math3D::NormalizeVector(direction);
+	auto items = vector<int>(); auto entries = vector<double>();
+	FindRay(origin, unit, radius, items, entries);
+
+	instanceId = -1; vertex = -1; distance = DBL_MAX;
+	auto radius2 = radius * radius;
+
+	for (auto i = 0; i < (int)items.size(); i++)
+	{
+		if (entries[i] > distance) break;
+
+		// Move the ray into the frame of the model
+		auto& P = scene->GetInstances()[items[i]].GetPose();
+		auto delta = Vec3d(origin.x - P(0, 3), origin.y - P(1, 3), origin.z - P(2, 3));
+		auto localOrigin = Vec3d(); auto localDirection = Vec3d();
+		for (auto row = 0; row < 3; row++) 
+		{
+			localOrigin[row] = P(0, row) * delta[0] + P(1, row) * delta[1] + P(2, row) * delta[2];
+			localDirection[row] = P(0, row) * unit[0] + P(1, row) * unit[1] + P(2, row) * unit[2];
+		}
+
+		auto model = scene->GetInstanceModel(items[i]);
+		auto& x = model->GetX(); auto& y = model->GetY(); auto& z = model->GetZ();
+
+		for (auto j = 0; j < model->VertexCount(); j++)
+		{
+			auto offset = Vec3d(x[j] - localOrigin[0], y[j] - localOrigin[1], z[j] - localOrigin[2]);
+			auto along = offset.dot(localDirection);
+			if (along < 0 || along >= distance) continue;
+			if (offset.dot(offset) - along * along > radius2) continue;
+
+			instanceId = items[i]; vertex = j; distance = along;
+		}
+	}
+
+	return instanceId >= 0;
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Build the hierarchy
+ */
+void Bvh::Build()
+{
+	_items.resize(_bounds.size());
+	for (auto i = 0; i < (int)_items.size(); i++) _items[i] = i;
+
+	_nodes.clear(); _nodes.reserve(max((size_t)1, 2 * _bounds.size()));
+	if (!_bounds.empty()) Build(0, (int)_items.size());
+}
+
+/**
+ * @brief Build the node for a range of items, splitting at the median of the longest axis of the box centers
+ * @param start The first item of the range
+ * @param end One past the last item of the range
+ * @return int The index of the new node
+ */
+int Bvh::Build(int start, int end)
+{
+	auto nodeIndex = (int)_nodes.size(); _nodes.push_back(BvhNode());
+
+	auto bounds = _bounds[_items[start]]; auto centers = Vec6d(DBL_MAX, -DBL_MAX, DBL_MAX, -DBL_MAX, DBL_MAX, -DBL_MAX);
+
+	for (auto i = start; i < end; i++)
+	{
+		auto& box = _bounds[_items[i]];
+		for (auto axis = 0; axis < 3; axis++)
+		{
+			bounds[axis * 2] = min(bounds[axis * 2], box[axis * 2]); bounds[axis * 2 + 1] = max(bounds[axis * 2 + 1], box[axis * 2 + 1]);
+			auto center = box[axis * 2] + box[axis * 2 + 1];
+			centers[axis * 2] = min(centers[axis * 2], center); centers[axis * 2 + 1] = max(centers[axis * 2 + 1], center);
+		}
+	}
+
+	_nodes[nodeIndex].Bounds = bounds;
+
+	if (end - start <= MAX_LEAF_SIZE)
+	{
+		_nodes[nodeIndex].First = start; _nodes[nodeIndex].Count = end - start;
+		return nodeIndex;
+	}
+
+	auto axis = 0;
+	for (auto i = 1; i < 3; i++) if (centers[i * 2 + 1] - centers[i * 2] > centers[axis * 2 + 1] - centers[axis * 2]) axis = i;
+
+	auto middle = start + (end - start) / 2;
+	nth_element(_items.begin() + start, _items.begin() + middle, _items.begin() + end, [&](int item1, int item2) 
+	{
+		return _bounds[item1][axis * 2] + _bounds[item1][axis * 2 + 1] < _bounds[item2][axis * 2] + _bounds[item2][axis * 2 + 1];
+	});
+
+	auto left = Build(start, middle); auto right = Build(middle, end);
+	_nodes[nodeIndex].Left = left; _nodes[nodeIndex].Right = right;
+
+	return nodeIndex;
+}
+
+/**
+ * @brief Find the items whose boxes pass a test. Subtrees whose bounds fail the test are skipped.
+ * @param test The test that is applied to the node and item bounds
+ * @param items The resultant items (ascending order)
+ */
+template <typename T> void Bvh::Find(T test, vector<int>& items)
+{
+	items.clear(); if (_nodes.empty()) return;
+
+	auto stack = vector<int> { 0 };
+
+	while (!stack.empty())
+	{
+		auto& node = _nodes[stack.back()]; stack.pop_back();
+		if (!test(node.Bounds)) continue;
+
+		if (node.Count > 0)
+		{
+			for (auto i = node.First; i < node.First + node.Count; i++) if (test(_bounds[_items[i]])) items.push_back(_items[i]);
+			continue;
+		}
+
+		stack.push_back(node.Right); stack.push_back(node.Left);
+	}
+
+	sort(items.begin(), items.end());
+}
+
+/**
+ * @brief Determine whether two boxes overlap
+ * @param bounds1 The first box
+ * @param bounds2 The second box
+ * @return bool True if the boxes overlap
+ */
+bool Bvh::Overlaps(const Vec6d& bounds1, const Vec6d& bounds2)
+{
+	for (auto axis = 0; axis < 3; axis++)
+	{
+		if (bounds1[axis * 2] > bounds2[axis * 2 + 1] || bounds2[axis * 2] > bounds1[axis * 2 + 1]) return false;
+	}
+	return true;
+}
+
+/**
+ * @brief Determine whether a ray hits a box (slab test)
+ * @param bounds The box that we are testing
+ * @param origin The origin of the ray
+ * @param inverse The reciprocal of each component of the ray direction
+ * @param radius The distance that the box is grown by
+ * @param distance The distance along the ray at which it enters the box (0 if it starts inside)
+ * @return bool True if the ray hits the box
+ */
+bool Bvh::IntersectsRay(const Vec6d& bounds, const Point3d& origin, const Vec3d& inverse, double radius, double& distance)
+{
+	double start[] = { origin.x, origin.y, origin.z };
+	auto near = 0.0; auto far = DBL_MAX;
+
+	for (auto axis = 0; axis < 3; axis++)
+	{
+		auto low = bounds[axis * 2] - radius; auto high = bounds[axis * 2 + 1] + radius;
+
+		if (inverse[axis] == DBL_MAX)
+		{
+			if (start[axis] < low || start[axis] > high) return false;
+			continue;
+		}
+
+		auto t1 = (low - start[axis]) * inverse[axis]; auto t2 = (high - start[axis]) * inverse[axis];
+		if (t1 > t2) swap(t1, t2);
+		near = max(near, t1); far = min(far, t2);
+		if (near > far) return false;
+	}
+
+	distance = near;
+	return true;
+}
@@ -0,0 +1,57 @@
+//--------------------------------------------------
+// Model: A bounding volume hierarchy over a set of axis aligned boxes (e.g. the instances of a scene)
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "../Model/Scene.h"
+#include "Frustum.h"
+
+namespace NVLib
+{
+	struct BvhNode
+	{
+		Vec6d Bounds;
+		int Left = -1;
+		int Right = -1;
+		int First = 0;
+		int Count = 0;
+	};
+
+	class Bvh
+	{
+	private:
+		vector<Vec6d> _bounds;
+		vector<int> _items;
+		vector<BvhNode> _nodes;
+	public:
+		Bvh(const vector<Vec6d>& bounds);
+		Bvh(Scene * scene);
+
+		void FindVisible(const Frustum& frustum, vector<int>& items);
+		void FindRange(const Vec6d& range, vector<int>& items);
+		void FindRay(const Point3d& origin, const Vec3d& direction, double radius, vector<int>& items, vector<double>& distances);
+		bool Pick(Scene * scene, const Point3d& origin, const Vec3d& direction, double radius, int& instanceId, int& vertex, double& distance);
+
+		inline int GetItemCount() { return (int)_bounds.size(); }
+		inline int GetNodeCount() { return (int)_nodes.size(); }
+		inline vector<BvhNode>& GetNodes() { return _nodes; }
+	private:
+		void Build();
+		int Build(int start, int end);
+		template <typename T> void Find(T test, vector<int>& items);
+		static bool Overlaps(const Vec6d& bounds1, const Vec6d& bounds2);
+		static bool IntersectsRay(const Vec6d& bounds, const Point3d& origin, const Vec3d& inverse, double radius, double& distance);
+	};
+}
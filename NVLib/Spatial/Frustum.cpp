@@ -0,0 +1,259 @@
+//--------------------------------------------------
+// Implementation of class Frustum
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "Frustum.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Build the frustum of a camera from the corners found by Math3D::GetViewLimits
+ * @param camera The camera matrix
+ * @param imageSize The size of the image
+ * @param zmin The near clipping distance (zero or more)
+ * @param zmax The far clipping distance (more than the near clipping distance)
+ * @param pose The 3x4 or 4x4 pose that maps world points into the frame of the camera
+ */
+Frustum::Frustum(Mat& camera, const Size& imageSize, double zmin, double zmax, Mat& pose)
+{
+	if (pose.type() != CV_64F || pose.total() < 12) throw runtime_error("The pose is expected to be a 3x4 or 4x4 CV_64F matrix");
+	Build(PinholeCamera::FromMat(camera), imageSize, zmin, zmax, Pose3d::FromMat(pose));
+}
+
+/**
+ * @brief Build the frustum of a camera
+ * @param camera The intrinsics of the camera
+ * @param imageSize The size of the image
+ * @param zmin The near clipping distance (zero or more)
+ * @param zmax The far clipping distance (more than the near clipping distance)
+ * @param pose The pose that maps world points into the frame of the camera
+ */
+Frustum::Frustum(const PinholeCamera& camera, const Size& imageSize, double zmin, double zmax, const Pose3d& pose)
+{
+	Build(camera, imageSize, zmin, zmax, pose);
+}
+
+/**
+ * @brief Build a frustum from a set of planes
+ * @param planes The planes (a, b, c, d), oriented so that ax + by + cz + d >= 0 inside the frustum
+ */
+Frustum::Frustum(const vector<Vec4d>& planes) : _planes(planes)
+{
+	// Extra implementation can go here
+}
+
+//--------------------------------------------------
+// Tests
+//--------------------------------------------------
+
+/**
+ * @brief Determine whether a point is inside the frustum
+ * @param point The point that we are testing
+ * @return bool True if the point is on the inside of every plane
+ */
+bool Frustum::Contains(const Point3d& point) const
+{
+	for (auto& plane : _planes)
+	{
+		if (plane[0] * point.x + plane[1] * point.y + plane[2] * point.z + plane[3] < 0) return false;
+	}
+	return true;
+}
+
+/**
+ * @brief Determine which of a set of points are inside the frustum, using the widest kernels available
+ * @param points The points that we are testing
+ * @param mask Set to 1 for each point inside the frustum and 0 otherwise
+ * @param count The number of points
+ */
+void Frustum::Contains(const Point3d * points, uchar * mask, size_t count) const
+{
+	if (_planes.empty()) { fill(mask, mask + count, (uchar)1); return; }
+
+	auto& kernels = Math3DKernels::Get(); auto planes = (const double *)&_planes[0];
+
+	Math3D::RunParallel(count, GRAIN_SIZE, [&](size_t first, size_t last)
+	{
+		kernels.InsideAoS(planes, _planes.size(), (const double *)(points + first), last - first, mask + first);
+	});
+}
+
+/**
+ * @brief Determine which of a set of points (held as separate coordinate arrays) are inside the frustum
+ * @param x The X coordinates
+ * @param y The Y coordinates
+ * @param z The Z coordinates
+ * @param mask Set to 1 for each point inside the frustum and 0 otherwise
+ * @param count The number of points
+ */
+void Frustum::Contains(const double * x, const double * y, const double * z, uchar * mask, size_t count) const
+{
+	if (_planes.empty()) { fill(mask, mask + count, (uchar)1); return; }
+
+	auto& kernels = Math3DKernels::Get(); auto planes = (const double *)&_planes[0];
+
+	Math3D::RunParallel(count, GRAIN_SIZE, [&](size_t first, size_t last)
+	{
+		kernels.Inside64(planes, _planes.size(), x + first, y + first, z + first, last - first, mask + first);
+	});
+}
+
+/**
+ * @brief Determine which of a set of points are inside the frustum
+ * @param points The points that we are testing
+ * @param mask The mask (resized to match the points), 1 for each point inside the frustum and 0 otherwise
+ */
+void Frustum::Contains(const vector<Point3d>& points, vector<uchar>& mask) const
+{
+	mask.resize(points.size());
+	if (!points.empty()) Contains(&points[0], &mask[0], points.size());
+}
+
+/**
+ * @brief Find the indices of the points that are inside the frustum
+ * @param points The points that we are testing
+ * @param indices The indices of the points inside the frustum, in order
+ */
+void Frustum::FindInside(const vector<Point3d>& points, vector<int>& indices) const
+{
+	auto mask = vector<uchar>(); Contains(points, mask);
+	Compact(mask, indices);
+}
+
+/**
+ * @brief Find the indices of the vertices of a model that are inside the frustum. A model whose bounds miss the 
+ * frustum is rejected without testing its vertices.
+ * @param model The model that we are testing
+ * @param indices The indices of the vertices inside the frustum, in order
+ */
+void Frustum::FindInside(Model * model, vector<int>& indices) const
+{
+	indices.clear();
+	if (model->VertexCount() == 0 || !IntersectsModel(model)) return;
+
+	auto mask = vector<uchar>(model->VertexCount());
+	Contains(&model->GetX()[0], &model->GetY()[0], &model->GetZ()[0], &mask[0], mask.size());
+	Compact(mask, indices);
+}
+
+/**
+ * @brief Determine whether an axis aligned box may overlap the frustum. The test is conservative: a box is only
+ * rejected if it lies completely outside one of the planes.
+ * @param bounds The bounds of the box (xmin, xmax, ymin, ymax, zmin, zmax)
+ * @return bool False if the box is definitely outside the frustum
+ */
+bool Frustum::IntersectsBox(const Vec6d& bounds) const
+{
+	for (auto& plane : _planes)
+	{
+		// Test the corner of the box that is furthest along the plane normal
+		auto x = plane[0] >= 0 ? bounds[1] : bounds[0];
+		auto y = plane[1] >= 0 ? bounds[3] : bounds[2];
+		auto z = plane[2] >= 0 ? bounds[5] : bounds[4];
+		if (plane[0] * x + plane[1] * y + plane[2] * z + plane[3] < 0) return false;
+	}
+	return true;
+}
+
+/**
+ * @brief Determine whether the bounds of a model may overlap the frustum
+ * @param model The model that we are testing
+ * @return bool False if the model is definitely outside the frustum
+ */
+bool Frustum::IntersectsModel(Model * model) const
+{
+	return model->VertexCount() > 0 && IntersectsBox(model->GetBounds());
+}
+
+/**
+ * @brief Find the instances of a scene whose bounds may overlap the frustum (without building a hierarchy)
+ * @param scene The scene that we are culling
+ * @param instances The indices of the instances that may be visible, in order
+ */
+void Frustum::FindVisible(Scene * scene, vector<int>& instances) const
+{
+	auto visible = vector<uchar>(scene->InstanceCount());
+
+	parallel_for_(cv::Range(0, scene->InstanceCount()), [&](const cv::Range& range)
+	{
+		for (auto i = range.start; i < range.end; i++) visible[i] = IntersectsBox(scene->GetInstanceBounds(i)) ? 1 : 0;
+	});
+
+	Compact(visible, instances);
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Find the planes of a camera frustum, from the corners of Math3D::GetViewLimits mapped into the world. The
+ * side planes pass through the camera center and the far corners, and the near plane is parallel to the far plane,
+ * so that a near distance of zero still gives well formed planes.
+ * @param camera The intrinsics of the camera
+ * @param imageSize The size of the image
+ * @param zmin The near clipping distance (zero or more)
+ * @param zmax The far clipping distance (more than the near clipping distance)
+ * @param pose The pose that maps world points into the frame of the camera
+ */
+void Frustum::Build(const PinholeCamera& camera, const Size& imageSize, double zmin, double zmax, const Pose3d& pose)
+{
+	if (!(zmin >= 0 && zmin < zmax)) throw runtime_error("The clipping distances are expected to satisfy 0 <= zmin < zmax");
+	if (imageSize.width <= 0 || imageSize.height <= 0) throw runtime_error("The image size of the camera is expected to be positive");
+
+	auto inverse = pose.Inverse();
+	auto limits = vector<Point3d>(); Math3D::GetViewLimits(camera, imageSize, zmin, zmax, limits);
+	auto corners = vector<Point3d>(); Math3D::TransformPointSet(inverse, limits, corners);
+	auto origin = inverse.Apply(Point3d(0, 0, 0)); auto nearPoint = inverse.Apply(Point3d(0, 0, zmin));
+
+	auto center = Point3d();
+	for (auto& corner : corners) center += corner * (1.0 / corners.size());
+
+	// Corners: 0-3 are near (top left, top right, bottom right, bottom left) and 4-7 are the same on the far plane
+	auto farPlane = GetPlane(corners[4], corners[5], corners[6], center);
+	auto normal = Vec3d(farPlane[0], farPlane[1], farPlane[2]);
+
+	_planes.push_back(Vec4d(-normal[0], -normal[1], -normal[2], normal.dot(Vec3d(nearPoint))));
+	_planes.push_back(farPlane);
+	_planes.push_back(GetPlane(origin, corners[7], corners[4], center));
+	_planes.push_back(GetPlane(origin, corners[6], corners[5], center));
+	_planes.push_back(GetPlane(origin, corners[5], corners[4], center));
+	_planes.push_back(GetPlane(origin, corners[6], corners[7], center));
+}
+
+/**
+ * @brief Gather the indices of the set entries of a mask
+ * @param mask The mask that we are compacting
+ * @param indices The indices of the non-zero entries, in order
+ */
+void Frustum::Compact(const vector<uchar>& mask, vector<int>& indices)
+{
+	indices.clear();
+	for (auto i = 0; i < (int)mask.size(); i++) if (mask[i] != 0) indices.push_back(i);
+}
+
+/**
+ * @brief Find the plane through three points, oriented towards a given inside point
+ * @param point1 The first point on the plane
+ * @param point2 The second point on the plane
+ * @param point3 The third point on the plane
+ * @param inside A point that is inside the frustum
+ * @return Vec4d The normalized plane (a, b, c, d)
+ */
+Vec4d Frustum::GetPlane(const Point3d& point1, const Point3d& point2, const Point3d& point3, const Point3d& inside)
+{
+	auto normal = Vec3d(point2 - point1).cross(Vec3d(point3 - point1));
+	normal = Math3D::NormalizeVector(normal);
+
+	auto d = -normal.dot(Vec3d(point1));
+	if (normal.dot(Vec3d(inside)) + d < 0) { normal = -normal; d = -d; }
+
+	return Vec4d(normal[0], normal[1], normal[2], d);
+}
@@ -0,0 +1,52 @@
+//--------------------------------------------------
+// Model: The viewing volume of a camera, held as six inward facing planes, with batched culling tests
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "../Math3D.h"
+#include "../Model/Scene.h"
+
+namespace NVLib
+{
+	class Frustum
+	{
+	private:
+		// The smallest number of points that is worth handing to a worker thread
+		static constexpr size_t GRAIN_SIZE = 4096;
+
+		vector<Vec4d> _planes;
+	public:
+		Frustum(Mat& camera, const Size& imageSize, double zmin, double zmax, Mat& pose);
+		Frustum(const PinholeCamera& camera, const Size& imageSize, double zmin, double zmax, const Pose3d& pose);
+		Frustum(const vector<Vec4d>& planes);
+
+		bool Contains(const Point3d& point) const;
+		void Contains(const Point3d * points, uchar * mask, size_t count) const;
+		void Contains(const double * x, const double * y, const double * z, uchar * mask, size_t count) const;
+		void Contains(const vector<Point3d>& points, vector<uchar>& mask) const;
+		void FindInside(const vector<Point3d>& points, vector<int>& indices) const;
+		void FindInside(Model * model, vector<int>& indices) const;
+
+		bool IntersectsBox(const Vec6d& bounds) const;
+		bool IntersectsModel(Model * model) const;
+		void FindVisible(Scene * scene, vector<int>& instances) const;
+
+		inline const vector<Vec4d>& GetPlanes() const { return _planes; }
+	private:
+		void Build(const PinholeCamera& camera, const Size& imageSize, double zmin, double zmax, const Pose3d& pose);
+		static void Compact(const vector<uchar>& mask, vector<int>& indices);
+		static Vec4d GetPlane(const Point3d& point1, const Point3d& point2, const Point3d& point3, const Point3d& inside);
+	};
+}
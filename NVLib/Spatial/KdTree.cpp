@@ -0,0 +1,363 @@
+//--------------------------------------------------
+// Implementation of class KdTree
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "KdTree.h"
+using namespace NVLib;
+
+// Subtrees smaller than this are built by a single thread
+#define MIN_PARALLEL_SIZE 16384
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Build the tree from a set of points. Results refer to the index of the point within the vector.
+ * @param points The points that we are building the tree from
+ */
+KdTree::KdTree(const vector<Point3d>& points)
+{
+	_points.resize(points.size()); _indices.resize(points.size());
+
+	for (auto i = 0; i < (int)points.size(); i++) 
+	{
+		_points[i] = Point3f((float)points[i].x, (float)points[i].y, (float)points[i].z); _indices[i] = i;
+	}
+
+	Build();
+}
+
+/**
+ * @brief Build the tree from the vertices of a model. Results refer to the index of the vertex.
+ * @param model The model that we are building the tree from
+ */
+KdTree::KdTree(Model * model)
+{
+	auto& x = model->GetX(); auto& y = model->GetY(); auto& z = model->GetZ();
+	_points.resize(x.size()); _indices.resize(x.size());
+
+	for (auto i = 0; i < (int)x.size(); i++)
+	{
+		_points[i] = Point3f((float)x[i], (float)y[i], (float)z[i]); _indices[i] = i;
+	}
+
+	Build();
+}
+
+/**
+ * @brief Build the tree from the valid (Z != 0) points of a cloud. Results refer to the pixel index (column + row * cols).
+ * @param colorCloud The CV_64FC(6) cloud that we are building the tree from
+ */
+KdTree::KdTree(Mat& colorCloud)
+{
+	if (colorCloud.type() != CV_64FC(6)) throw runtime_error("The color cloud is expected to be of type CV_64FC(6)");
+
+	_points.reserve(colorCloud.total()); _indices.reserve(colorCloud.total());
+
+	for (auto row = 0; row < colorCloud.rows; row++)
+	{
+		auto input = colorCloud.ptr<double>(row);
+
+		for (auto column = 0; column < colorCloud.cols; column++)
+		{
+			auto point = input + column * 6;
+			if (point[2] == 0) continue;
+
+			_points.push_back(Point3f((float)point[0], (float)point[1], (float)point[2]));
+			_indices.push_back(column + row * colorCloud.cols);
+		}
+	}
+
+	Build();
+}
+
+//--------------------------------------------------
+// Nearest Neighbour Queries
+//--------------------------------------------------
+
+/**
+ * @brief Find the nearest point to a query
+ * @param query The query point
+ * @param distance The distance to the nearest point
+ * @return int The index of the nearest point (-1 if the tree is empty)
+ */
+int KdTree::FindNearest(const Point3d& query, float& distance)
+{
+	auto index = -1; distance = FLT_MAX; auto count = 0;
+	auto point = Point3f((float)query.x, (float)query.y, (float)query.z);
+
+	SearchNearest(0, GetSize(), point, 1, count, &index, &distance);
+
+	if (count > 0) distance = sqrt(distance);
+	return index;
+}
+
+/**
+ * @brief Find the k nearest points to a query
+ * @param query The query point
+ * @param k The number of points that we want (must be positive)
+ * @param indices The indices of the nearest points (closest first)
+ * @param distances The distances to the nearest points
+ */
+void KdTree::FindNearest(const Point3d& query, int k, vector<int>& indices, vector<float>& distances)
+{
+	if (k <= 0) throw runtime_error("The number of nearest points needs to be positive");
+
+	indices.assign(k, -1); distances.assign(k, FLT_MAX); auto count = 0;
+	auto point = Point3f((float)query.x, (float)query.y, (float)query.z);
+
+	SearchNearest(0, GetSize(), point, k, count, indices.data(), distances.data());
+
+	indices.resize(count); distances.resize(count);
+	for (auto& distance : distances) distance = sqrt(distance);
+}
+
+/**
+ * @brief Find the k nearest points to each of a batch of queries (in parallel)
+ * @param queries The query points
+ * @param k The number of points that we want for each query (must be positive)
+ * @param indices A (query count x k) CV_32S matrix of the nearest indices (-1 where there are less than k points)
+ * @param distances A (query count x k) CV_32F matrix of the distances (FLT_MAX where there are less than k points)
+ */
+void KdTree::FindNearest(const vector<Point3d>& queries, int k, Mat& indices, Mat& distances)
+{
+	if (k <= 0) throw runtime_error("The number of nearest points needs to be positive");
+
+	indices.create((int)queries.size(), k, CV_32SC1); distances.create((int)queries.size(), k, CV_32FC1);
+
+	parallel_for_(cv::Range(0, (int)queries.size()), [&](const cv::Range& range)
+	{
+		for (auto i = range.start; i < range.end; i++)
+		{
+			auto indexRow = indices.ptr<int>(i); auto distanceRow = distances.ptr<float>(i);
+			for (auto j = 0; j < k; j++) { indexRow[j] = -1; distanceRow[j] = FLT_MAX; }
+
+			auto& query = queries[i]; auto count = 0;
+			SearchNearest(0, GetSize(), Point3f((float)query.x, (float)query.y, (float)query.z), k, count, indexRow, distanceRow);
+			for (auto j = 0; j < count; j++) distanceRow[j] = sqrt(distanceRow[j]);
+		}
+	});
+}
+
+//--------------------------------------------------
+// Radius Queries
+//--------------------------------------------------
+
+/**
+ * @brief Find all the points within a radius of a query
+ * @param query The query point
+ * @param radius The search radius
+ * @param indices The indices of the points that were found (in no particular order)
+ * @param distances The distances to the points that were found
+ */
+void KdTree::FindRadius(const Point3d& query, double radius, vector<int>& indices, vector<float>& distances)
+{
+	indices.clear(); distances.clear();
+	auto point = Point3f((float)query.x, (float)query.y, (float)query.z);
+
+	SearchRadius(0, GetSize(), point, (float)(radius * radius), indices, distances);
+
+	for (auto& distance : distances) distance = sqrt(distance);
+}
+
+/**
+ * @brief Find all the points within a radius of each of a batch of queries (in parallel)
+ * @param queries The query points
+ * @param radius The search radius
+ * @param indices The indices of the points found for each query
+ */
+void KdTree::FindRadius(const vector<Point3d>& queries, double radius, vector<vector<int>>& indices)
+{
+	indices.resize(queries.size());
+
+	parallel_for_(cv::Range(0, (int)queries.size()), [&](const cv::Range& range)
+	{
+		auto distances = vector<float>();
+
+		for (auto i = range.start; i < range.end; i++)
+		{
+			auto& query = queries[i]; indices[i].clear(); distances.clear();
+			SearchRadius(0, GetSize(), Point3f((float)query.x, (float)query.y, (float)query.z), (float)(radius * radius), indices[i], distances);
+		}
+	});
+}
+
+//--------------------------------------------------
+// Build
+//--------------------------------------------------
+
+/**
+ * @brief Build the tree. The tree is implicit: the node of the range [start, end) is the median at (start + end) / 2, 
+ * and its children are the ranges either side of it. The upper levels are split by a single thread, and the 
+ * resulting subtrees are then built in parallel.
+ */
+void KdTree::Build()
+{
+	_axes.assign(_points.size(), 0);
+
+	// The build works on a permutation of the points, which is applied once at the end
+	auto order = vector<int>(_points.size());
+	for (auto i = 0; i < (int)order.size(); i++) order[i] = i;
+
+	auto ranges = vector<cv::Range> { cv::Range(0, GetSize()) };
+	auto target = getNumThreads() * 4;
+
+	while ((int)ranges.size() < target)
+	{
+		auto next = vector<cv::Range>(); auto split = false;
+
+		for (auto& range : ranges)
+		{
+			if (range.size() < MIN_PARALLEL_SIZE) { next.push_back(range); continue; }
+
+			Split(order, range.start, range.end); split = true;
+			auto middle = (range.start + range.end) / 2;
+			next.push_back(cv::Range(range.start, middle)); next.push_back(cv::Range(middle + 1, range.end));
+		}
+
+		ranges = next;
+		if (!split) break;
+	}
+
+	parallel_for_(cv::Range(0, (int)ranges.size()), [&](const cv::Range& range)
+	{
+		for (auto i = range.start; i < range.end; i++) Build(order, ranges[i].start, ranges[i].end);
+	});
+
+	auto points = vector<Point3f>(_points.size()); auto indices = vector<int>(_indices.size());
+	for (auto i = 0; i < (int)order.size(); i++) { points[i] = _points[order[i]]; indices[i] = _indices[order[i]]; }
+	_points.swap(points); _indices.swap(indices);
+}
+
+/**
+ * @brief Build the subtree for a range of points
+ * @param order The permutation of the points
+ * @param start The start of the range
+ * @param end The end of the range
+ */
+void KdTree::Build(vector<int>& order, int start, int end)
+{
+	if (end - start <= 1) return;
+
+	Split(order, start, end);
+
+	auto middle = (start + end) / 2;
+	Build(order, start, middle); Build(order, middle + 1, end);
+}
+
+/**
+ * @brief Split a range of points on the median of its widest axis
+ * @param order The permutation of the points
+ * @param start The start of the range
+ * @param end The end of the range
+ */
+void KdTree::Split(vector<int>& order, int start, int end)
+{
+	auto lower = _points[order[start]]; auto upper = lower;
+
+	for (auto i = start + 1; i < end; i++)
+	{
+		auto& point = _points[order[i]];
+		lower.x = min(lower.x, point.x); upper.x = max(upper.x, point.x);
+		lower.y = min(lower.y, point.y); upper.y = max(upper.y, point.y);
+		lower.z = min(lower.z, point.z); upper.z = max(upper.z, point.z);
+	}
+
+	auto spread = upper - lower;
+	auto axis = spread.x >= spread.y && spread.x >= spread.z ? 0 : (spread.y >= spread.z ? 1 : 2);
+
+	auto middle = (start + end) / 2;
+	nth_element(order.begin() + start, order.begin() + middle, order.begin() + end, [&](int a, int b) 
+	{
+		return (&_points[a].x)[axis] < (&_points[b].x)[axis];
+	});
+
+	_axes[middle] = (uchar)axis;
+}
+
+//--------------------------------------------------
+// Search
+//--------------------------------------------------
+
+/**
+ * @brief Search a subtree for the nearest points
+ * @param start The start of the subtree range
+ * @param end The end of the subtree range
+ * @param query The query point
+ * @param k The number of points that we want
+ * @param count The number of points found so far
+ * @param indices The indices found so far (sorted by distance)
+ * @param distances The squared distances found so far
+ */
+void KdTree::SearchNearest(int start, int end, const Point3f& query, int k, int& count, int * indices, float * distances)
+{
+	while (end > start)
+	{
+		auto middle = (start + end) / 2; auto& point = _points[middle];
+
+		// Insert the node into the sorted result list
+		auto dx = point.x - query.x; auto dy = point.y - query.y; auto dz = point.z - query.z;
+		auto distance = dx * dx + dy * dy + dz * dz;
+
+		if (count < k || distance < distances[count - 1])
+		{
+			auto position = count < k ? count++ : k - 1;
+			while (position > 0 && distances[position - 1] > distance) 
+			{
+				distances[position] = distances[position - 1]; indices[position] = indices[position - 1]; position--;
+			}
+			distances[position] = distance; indices[position] = _indices[middle];
+		}
+
+		if (end - start == 1) return;
+
+		// Search the near side first, and only visit the far side if it could hold a closer point
+		auto axis = _axes[middle];
+		auto delta = (&query.x)[axis] - (&point.x)[axis];
+		auto nearStart = delta < 0 ? start : middle + 1; auto nearEnd = delta < 0 ? middle : end;
+		auto farStart = delta < 0 ? middle + 1 : start; auto farEnd = delta < 0 ? end : middle;
+
+		SearchNearest(nearStart, nearEnd, query, k, count, indices, distances);
+
+		if (count == k && delta * delta >= distances[count - 1]) return;
+		start = farStart; end = farEnd;
+	}
+}
+
+/**
+ * @brief Search a subtree for the points within a radius
+ * @param start The start of the subtree range
+ * @param end The end of the subtree range
+ * @param query The query point
+ * @param radius2 The squared search radius
+ * @param indices The indices of the points found
+ * @param distances The squared distances of the points found
+ */
+void KdTree::SearchRadius(int start, int end, const Point3f& query, float radius2, vector<int>& indices, vector<float>& distances)
+{
+	while (end > start)
+	{
+		auto middle = (start + end) / 2; auto& point = _points[middle];
+
+		auto dx = point.x - query.x; auto dy = point.y - query.y; auto dz = point.z - query.z;
+		auto distance = dx * dx + dy * dy + dz * dz;
+		if (distance <= radius2) { indices.push_back(_indices[middle]); distances.push_back(distance); }
+
+		if (end - start == 1) return;
+
+		auto axis = _axes[middle];
+		auto delta = (&query.x)[axis] - (&point.x)[axis];
+
+		if (delta <= 0 || delta * delta <= radius2)
+		{
+			if (delta * delta <= radius2) SearchRadius(middle + 1, end, query, radius2, indices, distances);
+			end = middle;
+		}
+		else start = middle + 1;
+	}
+}
@@ -0,0 +1,49 @@
+//--------------------------------------------------
+// Model: A static KD-tree for nearest neighbour and radius queries
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "../Model/Model.h"
+
+namespace NVLib
+{
+	class KdTree
+	{
+	private:
+		vector<Point3f> _points;
+		vector<int> _indices;
+		vector<uchar> _axes;
+	public:
+		KdTree(const vector<Point3d>& points);
+		KdTree(Model * model);
+		KdTree(Mat& colorCloud);
+
+		int FindNearest(const Point3d& query, float& distance);
+		void FindNearest(const Point3d& query, int k, vector<int>& indices, vector<float>& distances);
+		void FindNearest(const vector<Point3d>& queries, int k, Mat& indices, Mat& distances);
+		void FindRadius(const Point3d& query, double radius, vector<int>& indices, vector<float>& distances);
+		void FindRadius(const vector<Point3d>& queries, double radius, vector<vector<int>>& indices);
+
+		inline int GetSize() { return (int)_points.size(); }
+		inline Point3f& GetPoint(int node) { return _points[node]; }
+		inline int GetIndex(int node) { return _indices[node]; }
+	private:
+		void Build();
+		void Build(vector<int>& order, int start, int end);
+		void Split(vector<int>& order, int start, int end);
+		void SearchNearest(int start, int end, const Point3f& query, int k, int& count, int * indices, float * distances);
+		void SearchRadius(int start, int end, const Point3f& query, float radius2, vector<int>& indices, vector<float>& distances);
+	};
+}
@@ -0,0 +1,149 @@
+//--------------------------------------------------
+// Model: A flat open addressing hash map keyed on voxel coordinates
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+namespace NVLib
+{
+	template <typename T>
+	class VoxelHash
+	{
+	private:
+		vector<uint64_t> _keys;
+		vector<T> _values;
+		size_t _count;
+		size_t _mask;
+	public:
+		static constexpr uint64_t EMPTY = ~(uint64_t)0;
+		static constexpr int LIMIT = 1 << 20;
+
+		/**
+		 * @brief Main Constructor
+		 * @param capacity The expected number of entries
+		 */
+		VoxelHash(size_t capacity = 1024) : _count(0)
+		{
+			auto size = (size_t)16; while (size < capacity * 2) size <<= 1;
+			_keys.assign(size, EMPTY); _values.assign(size, T()); _mask = size - 1;
+		}
+
+		/**
+		 * @brief Retrieve the value associated with a key, adding a default value if the key is new.
+		 * Note that the reference is invalidated by later inserts.
+		 * @param key The key that we are looking up
+		 * @return T& The associated value
+		 */
+		T& Insert(uint64_t key)
+		{
+			if ((_count + 1) * 2 > _keys.size()) Grow();
+
+			auto slot = Hash(key) & _mask;
+			while (_keys[slot] != EMPTY && _keys[slot] != key) slot = (slot + 1) & _mask;
+
+			if (_keys[slot] == EMPTY) { _keys[slot] = key; _count++; }
+			return _values[slot];
+		}
+
+		/**
+		 * @brief Find the value associated with a key
+		 * @param key The key that we are looking up
+		 * @return T* The associated value or nullptr if the key was not found
+		 */
+		T * Find(uint64_t key)
+		{
+			auto slot = Hash(key) & _mask;
+
+			while (_keys[slot] != EMPTY)
+			{
+				if (_keys[slot] == key) return &_values[slot];
+				slot = (slot + 1) & _mask;
+			}
+
+			return nullptr;
+		}
+
+		/**
+		 * @brief Remove all the entries from the map
+		 */
+		void Clear()
+		{
+			fill(_keys.begin(), _keys.end(), EMPTY); fill(_values.begin(), _values.end(), T()); _count = 0;
+		}
+
+		/**
+		 * @brief Pack voxel coordinates into a key. Each coordinate is held in 21 bits, so it needs to be in [-LIMIT, LIMIT)
+		 * (coordinates outside this range alias other voxels, so callers need to check them first).
+		 * @param x The x coordinate of the voxel
+		 * @param y The y coordinate of the voxel
+		 * @param z The z coordinate of the voxel
+		 * @return uint64_t The resultant key
+		 */
+		static uint64_t GetKey(int x, int y, int z)
+		{
+			auto offset = LIMIT;
+			return ((uint64_t)(x + offset) & 0x1FFFFF) | (((uint64_t)(y + offset) & 0x1FFFFF) << 21) | (((uint64_t)(z + offset) & 0x1FFFFF) << 42);
+		}
+
+		/**
+		 * @brief Unpack a key into its voxel coordinates
+		 * @param key The key that we are unpacking
+		 * @return Vec3i The voxel coordinates
+		 */
+		static Vec3i GetCoordinates(uint64_t key)
+		{
+			auto offset = LIMIT;
+			return Vec3i((int)(key & 0x1FFFFF) - offset, (int)((key >> 21) & 0x1FFFFF) - offset, (int)((key >> 42) & 0x1FFFFF) - offset);
+		}
+
+		/**
+		 * @brief Mix the bits of a key (the splitmix64 finalizer)
+		 * @param key The key that we are hashing
+		 * @return uint64_t The hash value
+		 */
+		static uint64_t Hash(uint64_t key)
+		{
+			key ^= key >> 30; key *= 0xBF58476D1CE4E5B9ULL;
+			key ^= key >> 27; key *= 0x94D049BB133111EBULL;
+			return key ^ (key >> 31);
+		}
+
+		inline size_t Count() { return _count; }
+		inline size_t GetCapacity() { return _keys.size(); }
+		inline vector<uint64_t>& GetKeys() { return _keys; }
+		inline vector<T>& GetValues() { return _values; }
+	private:
+		/**
+		 * @brief Double the size of the table and reinsert the entries
+		 */
+		void Grow()
+		{
+			auto keys = vector<uint64_t>(_keys.size() * 2, EMPTY);
+			auto values = vector<T>(_keys.size() * 2, T());
+			auto mask = keys.size() - 1;
+
+			for (auto i = (size_t)0; i < _keys.size(); i++)
+			{
+				if (_keys[i] == EMPTY) continue;
+
+				auto slot = Hash(_keys[i]) & mask;
+				while (keys[slot] != EMPTY) slot = (slot + 1) & mask;
+
+				keys[slot] = _keys[i]; values[slot] = _values[i];
+			}
+
+			_keys.swap(keys); _values.swap(values); _mask = mask;
+		}
+	};
+}
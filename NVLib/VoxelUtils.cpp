@@ -0,0 +1,217 @@
+//--------------------------------------------------
+// Implementation code for VoxelUtils
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "VoxelUtils.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Downsample
+//--------------------------------------------------
+
+/**
+ * Downsample a color cloud by replacing the points within each voxel with their centroid and average color
+ * @param colorCloud The CV_64FC(6) cloud that we are downsampling (points with Z == 0 are skipped)
+ * @param voxelSize The width of the voxels
+ * @return Mat A dense (voxel count x 1) CV_64FC(6) cloud, in the order that the voxels are first reached
+ */
+Mat VoxelUtils::Downsample(Mat& colorCloud, double voxelSize)
+{
+	if (colorCloud.type() != CV_64FC(6)) throw runtime_error("The color cloud is expected to be of type CV_64FC(6)");
+
+	auto width = colorCloud.cols;
+	auto reader = [&](int index, Vec6d& point) 
+	{
+		auto data = colorCloud.ptr<double>(index / width) + (index % width) * 6;
+		for (auto i = 0; i < 6; i++) point[i] = data[i];
+		return data[2] != 0;
+	};
+
+	auto voxels = vector<Vec6d>(); Downsample((int)colorCloud.total(), reader, voxelSize, voxels);
+
+	Mat result = Mat((int)voxels.size(), 1, CV_64FC(6));
+	if (!voxels.empty()) memcpy(result.data, voxels.data(), voxels.size() * sizeof(Vec6d));
+	return result;
+}
+
+/**
+ * Downsample a model by replacing the vertices within each voxel with their centroid and average color
+ * @param model The model that we are downsampling
+ * @param voxelSize The width of the voxels
+ * @return Model * The resultant model, with the voxels in the order that they are first reached
+ */
+Model * VoxelUtils::Downsample(Model * model, double voxelSize)
+{
+	auto x = model->GetX().data(); auto y = model->GetY().data(); auto z = model->GetZ().data();
+	auto colors = model->GetColors().data();
+
+	auto reader = [&](int index, Vec6d& point) 
+	{
+		auto& color = colors[index];
+		point = Vec6d(x[index], y[index], z[index], color[0], color[1], color[2]);
+		return true;
+	};
+
+	auto voxels = vector<Vec6d>(); Downsample(model->VertexCount(), reader, voxelSize, voxels);
+
+	auto result = new Model();
+	result->Reserve((int)voxels.size());
+
+	for (auto& voxel : voxels)
+	{
+		result->AddVertex(Point3d(voxel[0], voxel[1], voxel[2]), Vec3i((int)round(voxel[3]), (int)round(voxel[4]), (int)round(voxel[5])));
+	}
+
+	return result;
+}
+
+/**
+ * The core of the downsampler. Points are partitioned on the upper half of the hash of their voxel key (parallel
+ * count, prefix sum and scatter), so that every voxel belongs to exactly one partition. The lower bits of the hash
+ * pick the slots of the partition hash maps, so they are left free to spread the keys of a partition out. Each partition then accumulates its voxels
+ * in its own hash map, without any locking. The voxels are returned in the order of their first point, so that the
+ * result does not depend on the number of partitions (and therefore threads).
+ * @param count The number of points
+ * @param reader A function (index, point) that reads a point as (X, Y, Z, C1, C2, C3) and returns false if it is invalid
+ * @param voxelSize The width of the voxels
+ * @param output The centroid and average color of each voxel
+ */
+template <typename R> void VoxelUtils::Downsample(int count, R reader, double voxelSize, vector<Vec6d>& output)
+{
+	if (voxelSize <= 0) throw runtime_error("The voxel size needs to be positive");
+
+	auto stripeCount = max(1, min(getNumThreads() * 4, count / 4096 + 1));
+	auto partitionCount = stripeCount;
+
+	// Find the voxel of each point and count the points in each (stripe, partition)
+	auto keys = vector<uint64_t>(count, VoxelHash<int>::EMPTY);
+	auto counts = vector<int>((size_t)stripeCount * partitionCount, 0);
+	auto outOfRange = atomic<bool>(false);
+
+	parallel_for_(cv::Range(0, stripeCount), [&](const cv::Range& range)
+	{
+		for (auto stripe = range.start; stripe < range.end; stripe++)
+		{
+			auto point = Vec6d(); auto stripeCounts = &counts[(size_t)stripe * partitionCount];
+
+			for (auto i = (int)((int64)count * stripe / stripeCount); i < (int)((int64)count * (stripe + 1) / stripeCount); i++)
+			{
+				if (!reader(i, point)) continue;
+				if (!FindVoxelKey(Point3d(point[0], point[1], point[2]), voxelSize, keys[i])) { outOfRange = true; keys[i] = VoxelHash<int>::EMPTY; continue; }
+				stripeCounts[(VoxelHash<int>::Hash(keys[i]) >> 32) % partitionCount]++;
+			}
+		}
+	});
+
+	if (outOfRange) throw runtime_error("Points fall outside the range of voxel coordinates that can be keyed, try a larger voxel size");
+
+	// Prefix sum and scatter the point indices into their partitions
+	auto offsets = vector<int>((size_t)stripeCount * partitionCount);
+	auto starts = vector<int>(partitionCount + 1, 0); auto total = 0;
+
+	for (auto partition = 0; partition < partitionCount; partition++)
+	{
+		starts[partition] = total;
+		for (auto stripe = 0; stripe < stripeCount; stripe++)
+		{
+			offsets[(size_t)stripe * partitionCount + partition] = total;
+			total += counts[(size_t)stripe * partitionCount + partition];
+		}
+	}
+	starts[partitionCount] = total;
+
+	auto indices = vector<int>(total);
+
+	parallel_for_(cv::Range(0, stripeCount), [&](const cv::Range& range)
+	{
+		for (auto stripe = range.start; stripe < range.end; stripe++)
+		{
+			auto stripeOffsets = &offsets[(size_t)stripe * partitionCount];
+
+			for (auto i = (int)((int64)count * stripe / stripeCount); i < (int)((int64)count * (stripe + 1) / stripeCount); i++)
+			{
+				if (keys[i] == VoxelHash<int>::EMPTY) continue;
+				indices[stripeOffsets[(VoxelHash<int>::Hash(keys[i]) >> 32) % partitionCount]++] = i;
+			}
+		}
+	});
+
+	// Accumulate the voxels of each partition
+	auto results = vector<vector<Vec6d>>(partitionCount);
+	auto firsts = vector<vector<int>>(partitionCount);
+
+	parallel_for_(cv::Range(0, partitionCount), [&](const cv::Range& range)
+	{
+		for (auto partition = range.start; partition < range.end; partition++)
+		{
+			auto size = starts[partition + 1] - starts[partition];
+			auto voxelIds = VoxelHash<int>(size / 4 + 1);
+			auto sums = vector<Vec6d>(); auto sizes = vector<int>();
+			auto point = Vec6d();
+
+			for (auto i = starts[partition]; i < starts[partition + 1]; i++)
+			{
+				auto index = indices[i]; reader(index, point);
+
+				auto& voxelId = voxelIds.Insert(keys[index]);
+				if (voxelId == 0) { sums.push_back(Vec6d()); sizes.push_back(0); firsts[partition].push_back(index); voxelId = (int)sums.size(); }
+
+				sums[voxelId - 1] += point; sizes[voxelId - 1]++;
+			}
+
+			auto& result = results[partition]; result.resize(sums.size());
+			for (auto i = 0; i < (int)sums.size(); i++) result[i] = sums[i] * (1.0 / sizes[i]);
+		}
+	});
+
+	// Gather the voxels in the order of their first point (the indices of a partition are in increasing order)
+	auto firstVoxel = vector<const Vec6d *>(count, nullptr);
+	for (auto partition = 0; partition < partitionCount; partition++)
+	{
+		for (auto i = 0; i < (int)firsts[partition].size(); i++) firstVoxel[firsts[partition][i]] = &results[partition][i];
+	}
+
+	output.clear(); output.reserve(total);
+	for (auto voxel : firstVoxel) if (voxel != nullptr) output.push_back(*voxel);
+}
+
+//--------------------------------------------------
+// GetVoxelKey
+//--------------------------------------------------
+
+/**
+ * Retrieve the key of the voxel that contains the given point
+ * @param point The point that we are finding the voxel for
+ * @param voxelSize The width of the voxels
+ * @return uint64_t The key of the voxel (see VoxelHash::GetKey)
+ */
+uint64_t VoxelUtils::GetVoxelKey(const Point3d& point, double voxelSize)
+{
+	auto key = uint64_t();
+	if (!FindVoxelKey(point, voxelSize, key)) throw runtime_error("The point falls outside the range of voxel coordinates that can be keyed");
+	return key;
+}
+
+/**
+ * Find the key of the voxel that contains the given point, checking that its coordinates fit within the key
+ * @param point The point that we are finding the voxel for
+ * @param voxelSize The width of the voxels
+ * @param key The key of the voxel
+ * @return bool False if a voxel coordinate is outside [-VoxelHash::LIMIT, VoxelHash::LIMIT) (or not a number)
+ */
+bool VoxelUtils::FindVoxelKey(const Point3d& point, double voxelSize, uint64_t& key)
+{
+	auto x = floor(point.x / voxelSize);
+	auto y = floor(point.y / voxelSize);
+	auto z = floor(point.z / voxelSize);
+
+	auto limit = (double)VoxelHash<int>::LIMIT;
+	if (!(x >= -limit && x < limit && y >= -limit && y < limit && z >= -limit && z < limit)) return false;
+
+	key = VoxelHash<int>::GetKey((int)x, (int)y, (int)z);
+	return true;
+}
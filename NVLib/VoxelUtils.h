@@ -0,0 +1,34 @@
+//--------------------------------------------------
+// A set of utilities for voxel grid operations on clouds
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "Model/Model.h"
+#include "Spatial/VoxelHash.h"
+
+namespace NVLib
+{
+	class VoxelUtils
+	{
+	public:
+		static Mat Downsample(Mat& colorCloud, double voxelSize);
+		static Model * Downsample(Model * model, double voxelSize);
+		static uint64_t GetVoxelKey(const Point3d& point, double voxelSize);
+	private:
+		template <typename R> static void Downsample(int count, R reader, double voxelSize, vector<Vec6d>& output);
+		static bool FindVoxelKey(const Point3d& point, double voxelSize, uint64_t& key);
+	};
+}
@@ -0,0 +1,146 @@
+//--------------------------------------------------
+// Unit Tests for class Bvh
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/Math3D.h>
+#include <NVLib/Model/Scene.h>
+#include <NVLib/Spatial/Bvh.h>
+using namespace NVLib;
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Build a scene of small cubes placed along the x axis
+ * @param count The number of instances within the scene
+ * @param spacing The distance between neighbouring instances
+ * @return Scene* The resultant scene
+ */
+static Scene * BuildScene(int count, double spacing)
+{
+	auto model = new Model();
+	for (auto i = 0; i < 8; i++) model->AddVertex(Point3d(i & 1 ? 0.5 : -0.5, i & 2 ? 0.5 : -0.5, i & 4 ? 0.5 : -0.5), Vec3i(i, 0, 0));
+
+	auto result = new Scene();
+	auto modelId = result->AddModel(model);
+
+	for (auto i = 0; i < count; i++)
+	{
+		Mat pose = Mat_<double>::eye(4, 4); pose.at<double>(0, 3) = i * spacing; pose.at<double>(2, 3) = 10;
+		result->AddInstance(modelId, pose);
+	}
+
+	return result;
+}
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the bounds of a model are found and refreshed when it changes
+ */
+TEST(Bvh_Test, model_bounds)
+{
+	// Setup
+	auto model = Model();
+	model.AddVertex(Point3d(1, -2, 3), Vec3i()); model.AddVertex(Point3d(-1, 2, 5), Vec3i());
+
+	// Execute
+	auto bounds1 = model.GetBounds();
+	model.AddVertex(Point3d(10, 0, 4), Vec3i());
+	auto bounds2 = model.GetBounds();
+
+	// Confirm
+	auto expected1 = Vec6d(-1, 1, -2, 2, 3, 5); auto expected2 = Vec6d(-1, 10, -2, 2, 3, 5);
+	for (auto i = 0; i < 6; i++) { ASSERT_EQ(bounds1[i], expected1[i]); ASSERT_EQ(bounds2[i], expected2[i]); }
+}
+
+/**
+ * @brief Confirm that range queries match a brute force search over the instance boxes
+ */
+TEST(Bvh_Test, range_matches_brute_force)
+{
+	// Setup
+	auto scene = BuildScene(100, 2);
+	auto bvh = Bvh(scene);
+	auto range = Vec6d(20.2, 61, -1, 1, 9, 11);
+
+	// Execute
+	auto items = vector<int>(); bvh.FindRange(range, items);
+
+	// Confirm
+	auto expected = vector<int>();
+	for (auto i = 0; i < scene->InstanceCount(); i++)
+	{
+		auto bounds = scene->GetInstanceBounds(i);
+		if (bounds[0] <= range[1] && bounds[1] >= range[0]) expected.push_back(i);
+	}
+
+	ASSERT_GT(bvh.GetNodeCount(), 1);
+	ASSERT_EQ(items, expected);
+
+	// Teardown
+	delete scene;
+}
+
+/**
+ * @brief Confirm that frustum culling keeps the instances in front of the camera
+ */
+TEST(Bvh_Test, frustum_culling)
+{
+	// Setup
+	auto scene = BuildScene(100, 2);
+	auto bvh = Bvh(scene);
+	Mat camera = Math3D::BuildKMatrix(500, Size(640, 480));
+	Mat pose = Mat_<double>::eye(4, 4);
+	auto frustum = Frustum(camera, Size(640, 480), 1, 20, pose);
+
+	// Execute
+	auto items = vector<int>(); bvh.FindVisible(frustum, items);
+
+	// Confirm
+	ASSERT_FALSE(items.empty());
+	ASSERT_EQ(items[0], 0);
+	ASSERT_LT((int)items.size(), 10);
+
+	for (auto i = 0; i < scene->InstanceCount(); i++)
+	{
+		auto visible = find(items.begin(), items.end(), i) != items.end();
+		ASSERT_EQ(visible, frustum.IntersectsBox(scene->GetInstanceBounds(i)));
+	}
+
+	// Teardown
+	delete scene;
+}
+
+/**
+ * @brief Confirm that picking returns the nearest vertex along the ray
+ */
+TEST(Bvh_Test, pick_nearest_vertex)
+{
+	// Setup
+	auto scene = BuildScene(10, 2);
+	auto bvh = Bvh(scene);
+	auto instanceId = -1; auto vertex = -1; auto distance = 0.0;
+
+	// Execute
+	auto hit = bvh.Pick(scene, Point3d(6.5, 0.5, 0), Vec3d(0, 0, 2), 0.1, instanceId, vertex, distance);
+
+	// Confirm
+	ASSERT_TRUE(hit);
+	ASSERT_EQ(instanceId, 3);
+	ASSERT_EQ(vertex, 3);
+	ASSERT_NEAR(distance, 9.5, 1e-9);
+	ASSERT_FALSE(bvh.Pick(scene, Point3d(7, 0, 0), Vec3d(0, 0, 1), 0.1, instanceId, vertex, distance));
+
+	// Teardown
+	delete scene;
+}
@@ -0,0 +1,190 @@
+//--------------------------------------------------
+// Unit Tests for the distortion aware camera model
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/Math3D.h>
+#include <NVLib/Camera/CameraModel.h>
+using namespace NVLib;
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Build the camera matrix of the test camera
+ * @return Mat The 3x3 CV_64F camera matrix
+ */
+static Mat BuildCamera()
+{
+	return (Mat_<double>(3, 3) << 520, 0, 322.5, 0, 515, 238.5, 0, 0, 1);
+}
+
+/**
+ * @brief Build a set of distortion coefficients with a noticeable amount of distortion
+ * @param count The number of coefficients (5 for the standard model, 8 for the rational model)
+ * @return Mat The 1 x count CV_64F coefficients
+ */
+static Mat BuildDistortion(int count)
+{
+	if (count == 8) return (Mat_<double>(1, 8) << 0.12, -0.05, 0.0008, -0.0006, 0.01, 0.3, -0.02, 0.015);
+	return (Mat_<double>(1, 5) << -0.28, 0.09, 0.001, -0.0015, -0.01);
+}
+
+/**
+ * @brief Build a camera model with a noticeable amount of distortion
+ * @return CameraModel* The resultant model
+ */
+static CameraModel * BuildModel()
+{
+	Mat camera = BuildCamera();
+	Mat distortion = BuildDistortion(5);
+	auto imageSize = Size(640, 480);
+	auto calibration = MonoCalibration(camera, distortion, imageSize);
+	return new CameraModel(calibration);
+}
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that distorting and then undistorting a set of pixels gives back the pixels, and that the
+ * distortion matches the remap tables
+ */
+TEST(CameraModel_Test, distort_undistort_round_trip)
+{
+	// Setup
+	auto model = BuildModel();
+	auto points = vector<Point2d>();
+	for (auto row = 0; row < 480; row += 37) for (auto column = 0; column < 640; column += 41) points.push_back(Point2d(column, row));
+
+	// Execute
+	auto distorted = vector<Point2d>(points.size()); model->DistortPoints(&points[0], &distorted[0], points.size());
+	auto undistorted = vector<Point2d>(points.size()); model->UndistortPoints(&distorted[0], &undistorted[0], points.size());
+
+	// Confirm
+	for (auto i = 0; i < (int)points.size(); i++)
+	{
+		auto row = (int)points[i].y; auto column = (int)points[i].x;
+		ASSERT_NEAR(distorted[i].x, model->GetMapX().at<float>(row, column), 1e-3);
+		ASSERT_NEAR(distorted[i].y, model->GetMapY().at<float>(row, column), 1e-3);
+		ASSERT_NEAR(undistorted[i].x, points[i].x, 1e-8);
+		ASSERT_NEAR(undistorted[i].y, points[i].y, 1e-8);
+	}
+
+	// Teardown
+	delete model;
+}
+
+/**
+ * @brief Confirm that projected points are lifted back to the same location, both as points and from a depth map
+ */
+TEST(CameraModel_Test, project_unproject_round_trip)
+{
+	// Setup
+	auto model = BuildModel();
+	auto pose = Pose3d(Rotation3d::FromEuler(Vec3d(5, -10, 3)), Vec3d(0.1, -0.2, 0.3));
+	auto points = vector<Point3d>();
+	for (auto i = 0; i < 200; i++) points.push_back(Point3d((i % 20 - 10) * 0.08, (i / 20 - 5) * 0.08, 2 + (i % 7) * 0.1));
+
+	Mat depth = Mat_<float>(480, 640); for (auto i = 0; i < 480 * 640; i++) ((float *)depth.data)[i] = i % 5 == 0 ? 0 : 1.5f;
+
+	// Execute
+	auto pixels = vector<Point2d>(points.size()); model->ProjectPoints(pose, &points[0], &pixels[0], points.size());
+
+	auto local = vector<Point3d>(points.size()); auto depths = vector<double>(points.size());
+	for (auto i = 0; i < (int)points.size(); i++) { local[i] = pose.Apply(points[i]); depths[i] = local[i].z; }
+	auto lifted = vector<Point3d>(points.size()); model->UnProjectPoints(&pixels[0], &depths[0], &lifted[0], points.size());
+
+	Mat cloud; model->UnProjectDepth(depth, cloud);
+
+	// Confirm
+	for (auto i = 0; i < (int)points.size(); i++)
+	{
+		ASSERT_NEAR(lifted[i].x, local[i].x, 1e-8); ASSERT_NEAR(lifted[i].y, local[i].y, 1e-8); ASSERT_NEAR(lifted[i].z, local[i].z, 1e-12);
+	}
+
+	for (auto row = 0; row < 480; row += 31)
+	{
+		for (auto column = 0; column < 640; column += 29)
+		{
+			auto point = cloud.at<Vec3d>(row, column);
+			if (depth.at<float>(row, column) == 0) { ASSERT_EQ(point[2], 0); continue; }
+
+			auto location = Point3d(point[0], point[1], point[2]); Point2d pixel; model->ProjectPoints(&location, &pixel, 1);
+			ASSERT_NEAR(pixel.x, column, 1e-8); ASSERT_NEAR(pixel.y, row, 1e-8);
+		}
+	}
+
+	// Teardown
+	delete model;
+}
+
+/**
+ * @brief Confirm that the projection, the undistortion and the remap tables match OpenCV, for both the standard
+ * (5 coefficient) and the rational (8 coefficient) distortion models
+ */
+TEST(CameraModel_Test, matches_opencv)
+{
+	for (auto count : { 5, 8 })
+	{
+		// Setup
+		Mat camera = BuildCamera(); Mat distortion = BuildDistortion(count);
+		auto imageSize = Size(640, 480);
+		auto model = CameraModel(camera, distortion, imageSize);
+
+		auto rvec = Vec3d(0.08, -0.17, 0.05); auto tvec = Vec3d(0.1, -0.2, 0.3);
+		auto points = vector<Point3d>();
+		for (auto i = 0; i < 200; i++) points.push_back(Point3d((i % 20 - 10) * 0.08, (i / 20 - 5) * 0.08, 2 + (i % 7) * 0.1));
+
+		auto pixels = vector<Point2d>();
+		for (auto row = 0; row < 480; row += 37) for (auto column = 0; column < 640; column += 41) pixels.push_back(Point2d(column, row));
+
+		// Execute
+		auto projected = vector<Point2d>(points.size()); model.ProjectPoints(Pose3d::FromVectors(rvec, tvec), &points[0], &projected[0], points.size());
+		auto undistorted = vector<Point2d>(pixels.size()); model.UndistortPoints(&pixels[0], &undistorted[0], pixels.size());
+
+		// Confirm
+		auto expectedProjected = vector<Point2d>(); projectPoints(points, rvec, tvec, camera, distortion, expectedProjected);
+		for (auto i = 0; i < (int)points.size(); i++)
+		{
+			ASSERT_NEAR(projected[i].x, expectedProjected[i].x, 1e-6); ASSERT_NEAR(projected[i].y, expectedProjected[i].y, 1e-6);
+		}
+
+		auto expectedUndistorted = vector<Point2d>();
+		undistortPoints(pixels, expectedUndistorted, camera, distortion, Mat(), camera, TermCriteria(TermCriteria::COUNT + TermCriteria::EPS, 100, 1e-12));
+		for (auto i = 0; i < (int)pixels.size(); i++)
+		{
+			ASSERT_NEAR(undistorted[i].x, expectedUndistorted[i].x, 1e-4); ASSERT_NEAR(undistorted[i].y, expectedUndistorted[i].y, 1e-4);
+		}
+
+		Mat mapX, mapY; initUndistortRectifyMap(camera, distortion, Mat(), camera, imageSize, CV_32FC1, mapX, mapY);
+		for (auto row = 0; row < 480; row += 13)
+		{
+			for (auto column = 0; column < 640; column += 17)
+			{
+				ASSERT_NEAR(model.GetMapX().at<float>(row, column), mapX.at<float>(row, column), 1e-3);
+				ASSERT_NEAR(model.GetMapY().at<float>(row, column), mapY.at<float>(row, column), 1e-3);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Confirm that unsupported distortion models are rejected
+ */
+TEST(CameraModel_Test, reject_unsupported_distortion)
+{
+	// Setup
+	Mat camera = Math3D::BuildKMatrix(500, Size(64, 48));
+	Mat distortion = Mat_<double>(1, 6); distortion.setTo(0.01);
+
+	// Execute and Confirm
+	ASSERT_THROW(CameraModel(camera, distortion, Size(64, 48)), runtime_error);
+}
@@ -0,0 +1,303 @@
+//--------------------------------------------------
+// Unit Tests for class CloudUtils
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/Math3D.h>
+#include <NVLib/CloudUtils.h>
+#include <NVLib/PoseUtils.h>
+using namespace NVLib;
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Build a test color image
+ * @param size The size of the image
+ * @return Mat The resultant image
+ */
+static Mat BuildColor(const Size& size)
+{
+	Mat result = Mat_<Vec3b>(size);
+	for (auto i = 0; i < size.area() * 3; i++) result.data[i] = (uchar)(i % 251);
+	return result;
+}
+
+/**
+ * @brief Build a 16-bit depth map (in millimeters) that has a set of holes in it
+ * @param size The size of the depth map
+ * @return Mat The resultant depth map
+ */
+static Mat BuildDepth(const Size& size)
+{
+	Mat result = Mat_<ushort>(size);
+	auto data = (ushort *)result.data;
+	for (auto i = 0; i < size.area(); i++) data[i] = (i % 7 == 0) ? 0 : (ushort)(1000 + i);
+	return result;
+}
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that a native 16-bit depth map gives the same cloud as the equivalent double depth map
+ */
+TEST(CloudUtils_Test, build_cloud_from_native_depth)
+{
+	// Setup
+	Mat camera = Math3D::BuildKMatrix(500, Size(40, 30));
+	Mat color = BuildColor(Size(40, 30));
+	Mat depth = BuildDepth(Size(40, 30));
+	Mat depthDouble; depth.convertTo(depthDouble, CV_64F, 1e-3);
+
+	// Execute
+	Mat expected = CloudUtils::BuildColorCloud(camera, color, depthDouble);
+	Mat actual; CloudUtils::BuildColorCloud(camera, color, depth, actual, 1e-3);
+
+	// Confirm
+	ASSERT_EQ(actual.type(), CV_64FC(6));
+	ASSERT_EQ(actual.rows, expected.rows); ASSERT_EQ(actual.cols, expected.cols);
+	for (auto i = 0; i < (int)expected.total() * 6; i++) ASSERT_NEAR(((double *)expected.data)[i], ((double *)actual.data)[i], 1e-9);
+}
+
+/**
+ * @brief Confirm that the cloud builder handles a depth map that is a non-continuous region of a larger image
+ */
+TEST(CloudUtils_Test, build_cloud_from_roi)
+{
+	// Setup
+	Mat color = BuildColor(Size(40, 30));
+	Mat depth = BuildDepth(Size(40, 30));
+	Mat camera = Math3D::BuildKMatrix(500, Size(20, 10));
+	auto region = Rect(5, 7, 20, 10);
+	Mat colorRoi = color(region); Mat depthRoi = depth(region);
+	Mat colorCopy = colorRoi.clone(); Mat depthCopy = depthRoi.clone();
+
+	// Execute
+	Mat expected; CloudUtils::BuildColorCloud(camera, colorCopy, depthCopy, expected, 1e-3);
+	Mat actual; CloudUtils::BuildColorCloud(camera, colorRoi, depthRoi, actual, 1e-3);
+
+	// Confirm
+	for (auto i = 0; i < (int)expected.total() * 6; i++) ASSERT_EQ(((double *)expected.data)[i], ((double *)actual.data)[i]);
+}
+
+/**
+ * @brief Confirm that a color cloud survives the round trip through the compact point cloud
+ */
+TEST(CloudUtils_Test, point_cloud_round_trip)
+{
+	// Setup
+	Mat camera = Math3D::BuildKMatrix(500, Size(40, 30));
+	Mat color = BuildColor(Size(40, 30));
+	Mat depth = BuildDepth(Size(40, 30));
+	Mat expected; CloudUtils::BuildColorCloud(camera, color, depth, expected, 1e-3);
+
+	// Execute
+	auto cloud = PointCloud(); CloudUtils::ConvertCloud(expected, cloud);
+	Mat actual; CloudUtils::ConvertCloud(cloud, actual);
+
+	// Confirm
+	ASSERT_EQ(cloud.GetWidth(), 40); ASSERT_EQ(cloud.GetHeight(), 30);
+	ASSERT_EQ(cloud.ValidCount(), CloudUtils::GetVertexCount(expected));
+	ASSERT_EQ((int)cloud.GetIndices().size(), cloud.ValidCount());
+	for (auto i = 0; i < (int)expected.total() * 6; i++) ASSERT_NEAR(((double *)expected.data)[i], ((double *)actual.data)[i], 1e-4);
+}
+
+/**
+ * @brief Confirm that rendering a cloud from the camera that built it gives back the original color and depth
+ */
+TEST(CloudUtils_Test, render_cloud_from_source_camera)
+{
+	// Setup
+	Mat camera = Math3D::BuildKMatrix(500, Size(40, 30));
+	Mat color = BuildColor(Size(40, 30));
+	Mat depth = BuildDepth(Size(40, 30));
+	Mat cloud; CloudUtils::BuildColorCloud(camera, color, depth, cloud, 1e-3);
+	Mat pose = Mat_<double>::eye(4, 4);
+
+	// Execute
+	Mat image, renderDepth; CloudUtils::RenderImage(cloud, Math3D::GetProjection(camera, pose), color.size(), image, renderDepth, 1);
+
+	// Confirm
+	for (auto row = 0; row < color.rows; row++)
+	{
+		for (auto column = 0; column < color.cols; column++)
+		{
+			auto expectedDepth = depth.at<ushort>(row, column) * 1e-3;
+			ASSERT_NEAR(renderDepth.at<float>(row, column), expectedDepth, 1e-5);
+			if (expectedDepth == 0) continue;
+			for (auto i = 0; i < 3; i++) ASSERT_EQ(image.at<Vec3b>(row, column)[i], color.at<Vec3b>(row, column)[i]);
+		}
+	}
+}
+
+/**
+ * @brief Confirm that the fused projection matches a transform followed by a projection
+ */
+TEST(CloudUtils_Test, fused_projection_matches_transform_and_project)
+{
+	// Setup
+	Mat camera = Math3D::BuildKMatrix(500, Size(40, 30));
+	Mat color = BuildColor(Size(40, 30));
+	Mat depth = BuildDepth(Size(40, 30));
+	Mat cloud; CloudUtils::BuildColorCloud(camera, color, depth, cloud, 1e-3);
+	Mat pose = PoseUtils::Vectors2Pose(Vec3d(0.05, -0.02, 0.01), Vec3d(0.1, 0.05, 0.2));
+	Mat distortion;
+
+	// Execute
+	Mat imagePoints, pointDepth; CloudUtils::ProjectImagePoints(camera, distortion, pose, cloud, imagePoints, pointDepth);
+
+	// Confirm
+	Mat moved = CloudUtils::TransformCloud(cloud, pose);
+	Mat expected = CloudUtils::ProjectImagePoints(camera, moved);
+
+	for (auto row = 0; row < cloud.rows; row++)
+	{
+		for (auto column = 0; column < cloud.cols; column++)
+		{
+			auto Z = moved.ptr<double>(row)[column * 6 + 2];
+			ASSERT_NEAR(pointDepth.at<float>(row, column), Z, 1e-5);
+			if (Z <= 0) continue;
+			ASSERT_NEAR(imagePoints.at<Vec2f>(row, column)[0], expected.at<Vec2d>(row, column)[0], 1e-3);
+			ASSERT_NEAR(imagePoints.at<Vec2f>(row, column)[1], expected.at<Vec2d>(row, column)[1], 1e-3);
+		}
+	}
+}
+
+/**
+ * @brief Confirm that the fused projection applies the (k1, k2, p1, p2, k3) distortion model the same way as OpenCV
+ */
+TEST(CloudUtils_Test, fused_projection_matches_opencv_distortion)
+{
+	// Setup
+	Mat camera = Math3D::BuildKMatrix(500, Size(40, 30));
+	Mat color = BuildColor(Size(40, 30));
+	Mat depth = BuildDepth(Size(40, 30));
+	Mat cloud; CloudUtils::BuildColorCloud(camera, color, depth, cloud, 1e-3);
+	auto rvec = Vec3d(0.05, -0.02, 0.01); auto tvec = Vec3d(0.1, 0.05, 0.2);
+	Mat pose = PoseUtils::Vectors2Pose(rvec, tvec);
+	Mat distortion = (Mat_<double>(1, 5) << -0.21, 0.08, 0.0012, -0.0009, -0.015);
+
+	// Execute
+	Mat imagePoints; CloudUtils::ProjectImagePoints(camera, distortion, pose, cloud, imagePoints);
+
+	// Confirm
+	auto points = vector<Point3d>(); auto pixels = vector<Point>();
+	for (auto row = 0; row < cloud.rows; row++)
+	{
+		for (auto column = 0; column < cloud.cols; column++)
+		{
+			auto point = cloud.ptr<double>(row) + column * 6;
+			if (point[2] == 0) { ASSERT_EQ(imagePoints.at<Vec2f>(row, column)[0], -1); continue; }
+			points.push_back(Point3d(point[0], point[1], point[2])); pixels.push_back(Point(column, row));
+		}
+	}
+
+	auto expected = vector<Point2d>(); projectPoints(points, rvec, tvec, camera, distortion, expected);
+
+	for (auto i = 0; i < (int)pixels.size(); i++)
+	{
+		auto actual = imagePoints.at<Vec2f>(pixels[i].y, pixels[i].x);
+		ASSERT_NEAR(actual[0], expected[i].x, 1e-3); ASSERT_NEAR(actual[1], expected[i].y, 1e-3);
+	}
+}
+
+/**
+ * @brief Confirm that compaction keeps the valid points in row major order, along with their pixel indices
+ */
+TEST(CloudUtils_Test, compact_cloud)
+{
+	// Setup
+	Mat camera = Math3D::BuildKMatrix(500, Size(40, 30));
+	Mat color = BuildColor(Size(40, 30));
+	Mat depth = BuildDepth(Size(40, 30));
+	Mat cloud; CloudUtils::BuildColorCloud(camera, color, depth, cloud, 1e-3);
+
+	// Execute
+	Mat compact, indices; CloudUtils::CompactCloud(cloud, compact, indices);
+
+	// Confirm
+	ASSERT_EQ(compact.rows, CloudUtils::GetVertexCount(cloud));
+	ASSERT_EQ(indices.rows, compact.rows);
+
+	auto position = 0;
+	for (auto index = 0; index < (int)cloud.total(); index++)
+	{
+		auto point = cloud.ptr<double>(index / cloud.cols) + (index % cloud.cols) * 6;
+		if (point[2] == 0) continue;
+
+		ASSERT_EQ(indices.at<int>(position), index);
+		for (auto i = 0; i < 6; i++) ASSERT_EQ(compact.ptr<double>(position)[i], point[i]);
+		position++;
+	}
+
+	ASSERT_EQ(position, compact.rows);
+}
+
+/**
+ * @brief Confirm that the bounds of a cloud only cover the valid points
+ */
+TEST(CloudUtils_Test, cloud_bounds)
+{
+	// Setup
+	Mat camera = Math3D::BuildKMatrix(500, Size(40, 30));
+	Mat color = BuildColor(Size(40, 30));
+	Mat depth = BuildDepth(Size(40, 30));
+	Mat cloud; CloudUtils::BuildColorCloud(camera, color, depth, cloud, 1e-3);
+
+	auto points = vector<Point3d>();
+	for (auto index = 0; index < (int)cloud.total(); index++)
+	{
+		auto point = cloud.ptr<double>(index / cloud.cols) + (index % cloud.cols) * 6;
+		if (point[2] != 0) points.push_back(Point3d(point[0], point[1], point[2]));
+	}
+
+	// Execute
+	auto bounds = CloudUtils::GetCloudBounds(cloud);
+	Mat empty = Mat(2, 2, CV_64FC(6), Scalar::all(0)); auto emptyBounds = CloudUtils::GetCloudBounds(empty);
+
+	// Confirm
+	auto expected = Math3D::GetCloudBounds(points);
+	ASSERT_GT(bounds[4], 0);
+	for (auto i = 0; i < 6; i++) { ASSERT_EQ(bounds[i], expected[i]); ASSERT_EQ(emptyBounds[i], 0); }
+}
+
+/**
+ * @brief Confirm that clouds built from cached rays match the direct build, and that distorted clouds reproject
+ */
+TEST(CloudUtils_Test, build_cloud_from_cached_rays)
+{
+	// Setup
+	Mat camera = Math3D::BuildKMatrix(500, Size(40, 30));
+	Mat distortion = (Mat_<double>(1, 5) << -0.25, 0.08, 0.001, -0.001, 0);
+	Mat color = BuildColor(Size(40, 30));
+	Mat depth = BuildDepth(Size(40, 30));
+	Mat expected; CloudUtils::BuildColorCloud(camera, color, depth, expected, 1e-3);
+
+	// Execute
+	Mat rays = RayCache::GetDefault().GetRays(camera, depth.size());
+	Mat cloud; CloudUtils::BuildRayCloud(rays, color, depth, cloud, 1e-3);
+	Mat distorted; CloudUtils::BuildColorCloud(camera, distortion, color, depth, distorted, 1e-3);
+
+	// Confirm
+	auto model = CameraModel(camera, distortion, depth.size());
+
+	for (auto index = 0; index < (int)cloud.total(); index++)
+	{
+		auto row = index / cloud.cols; auto column = index % cloud.cols;
+		for (auto i = 0; i < 6; i++) ASSERT_EQ(cloud.ptr<double>(row)[column * 6 + i], expected.ptr<double>(row)[column * 6 + i]);
+
+		auto point = distorted.ptr<double>(row) + column * 6;
+		if (point[2] == 0) continue;
+
+		auto location = Point3d(point[0], point[1], point[2]); Point2d pixel; model.ProjectPoints(&location, &pixel, 1);
+		ASSERT_NEAR(pixel.x, column, 1e-8); ASSERT_NEAR(pixel.y, row, 1e-8);
+	}
+}
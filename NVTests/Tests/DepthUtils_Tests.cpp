@@ -0,0 +1,147 @@
+//--------------------------------------------------
+// Unit Tests for class DepthUtils
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/DepthUtils.h>
+using namespace NVLib;
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Build a depth image with a step from 1000 (left half) to 2000 (right half)
+ * @param size The size of the image
+ * @return Mat The resultant CV_16U depth image
+ */
+static Mat BuildStep(const Size& size)
+{
+	Mat result = Mat_<ushort>(size);
+
+	for (auto row = 0; row < size.height; row++)
+	{
+		for (auto column = 0; column < size.width; column++) result.at<ushort>(row, column) = column < size.width / 2 ? 1000 : 2000;
+	}
+
+	return result;
+}
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the median filter removes speckle in place without filling holes
+ */
+TEST(DepthUtils_Test, median_removes_speckle_in_place)
+{
+	// Setup
+	Mat depth = Mat_<ushort>(10, 10); depth.setTo(1000);
+	depth.at<ushort>(4, 4) = 3000; depth.at<ushort>(7, 2) = 0;
+
+	// Execute
+	DepthUtils::MedianFilter(depth, depth, 1);
+
+	// Confirm
+	ASSERT_EQ(depth.at<ushort>(4, 4), 1000);
+	ASSERT_EQ(depth.at<ushort>(7, 2), 0);
+	ASSERT_EQ(depth.at<ushort>(0, 0), 1000);
+}
+
+/**
+ * @brief Confirm that the bilateral filter smooths noise without blurring a depth edge
+ */
+TEST(DepthUtils_Test, bilateral_preserves_edges)
+{
+	// Setup
+	Mat step = BuildStep(Size(20, 10)); Mat depth; step.convertTo(depth, CV_32F);
+	for (auto row = 0; row < depth.rows; row++) for (auto column = 0; column < depth.cols; column++) depth.at<float>(row, column) += (row + column) % 2 == 0 ? 2.0f : -2.0f;
+
+	// Execute
+	Mat output; DepthUtils::BilateralFilter(depth, output, 2, 2.0, 20.0);
+
+	// Confirm
+	ASSERT_EQ(output.type(), CV_32F);
+	for (auto row = 2; row < depth.rows - 2; row++)
+	{
+		for (auto column = 0; column < depth.cols; column++)
+		{
+			auto expected = (double)step.at<ushort>(row, column);
+			ASSERT_LT(fabs(output.at<float>(row, column) - expected), 1.5);
+		}
+	}
+}
+
+/**
+ * @brief Confirm that filtering in place gives the same result as filtering into a separate image
+ */
+TEST(DepthUtils_Test, filters_match_in_place)
+{
+	// Setup
+	auto random = RNG(7); Mat depth = Mat_<ushort>(64, 30);
+	for (auto row = 0; row < depth.rows; row++) for (auto column = 0; column < depth.cols; column++) depth.at<ushort>(row, column) = random.uniform(0, 10) == 0 ? 0 : (ushort)random.uniform(1000, 1100);
+	Mat median = depth.clone(); Mat bilateral = depth.clone();
+
+	// Execute
+	Mat expectedMedian; DepthUtils::MedianFilter(depth, expectedMedian, 5);
+	Mat expectedBilateral; DepthUtils::BilateralFilter(depth, expectedBilateral, 5, 2.0, 20.0);
+	DepthUtils::MedianFilter(median, median, 5);
+	DepthUtils::BilateralFilter(bilateral, bilateral, 5, 2.0, 20.0);
+
+	// Confirm
+	for (auto row = 0; row < depth.rows; row++)
+	{
+		for (auto column = 0; column < depth.cols; column++)
+		{
+			ASSERT_EQ(median.at<ushort>(row, column), expectedMedian.at<ushort>(row, column));
+			ASSERT_EQ(bilateral.at<ushort>(row, column), expectedBilateral.at<ushort>(row, column));
+		}
+	}
+}
+
+/**
+ * @brief Confirm that pixels between two surfaces are removed
+ */
+TEST(DepthUtils_Test, remove_flying_pixels)
+{
+	// Setup
+	Mat depth = BuildStep(Size(20, 10));
+	for (auto row = 0; row < depth.rows; row++) depth.at<ushort>(row, 10) = 1500;
+
+	// Execute
+	DepthUtils::RemoveFlyingPixels(depth, depth, 0.1);
+
+	// Confirm
+	for (auto row = 0; row < depth.rows; row++)
+	{
+		ASSERT_EQ(depth.at<ushort>(row, 10), 0);
+		ASSERT_EQ(depth.at<ushort>(row, 9), 1000);
+		ASSERT_EQ(depth.at<ushort>(row, 11), 2000);
+		ASSERT_EQ(depth.at<ushort>(row, 5), 1000);
+		ASSERT_EQ(depth.at<ushort>(row, 15), 2000);
+	}
+}
+
+/**
+ * @brief Confirm that a clean step between two surfaces is left alone
+ */
+TEST(DepthUtils_Test, remove_flying_pixels_keeps_edges)
+{
+	// Setup
+	Mat depth = BuildStep(Size(20, 10));
+
+	// Execute
+	Mat output; DepthUtils::RemoveFlyingPixels(depth, output, 0.1, 2);
+
+	// Confirm
+	for (auto row = 0; row < depth.rows; row++)
+	{
+		for (auto column = 0; column < depth.cols; column++) ASSERT_EQ(output.at<ushort>(row, column), depth.at<ushort>(row, column));
+	}
+}
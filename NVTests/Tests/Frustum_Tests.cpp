@@ -0,0 +1,172 @@
+//--------------------------------------------------
+// Unit Tests for class Frustum
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/Math3D.h>
+#include <NVLib/Model/Scene.h>
+#include <NVLib/Spatial/Frustum.h>
+using namespace NVLib;
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Build a model holding a grid of points, some of which are in front of the test camera
+ * @return Model* The resultant model
+ */
+static Model * BuildModel()
+{
+	auto result = new Model();
+
+	for (auto i = 0; i < 20011; i++)
+	{
+		auto x = ((i * 37) % 101 - 50) * 0.2; auto y = ((i * 53) % 97 - 48) * 0.2; auto z = ((i * 11) % 89 - 20) * 0.3;
+		result->AddVertex(Point3d(x, y, z), Vec3i());
+	}
+
+	return result;
+}
+
+/**
+ * @brief Build the frustum of a camera that has been turned and moved away from the origin
+ * @return Frustum The resultant frustum
+ */
+static Frustum BuildFrustum()
+{
+	auto camera = PinholeCamera(500, 500, 320, 240);
+	auto pose = Pose3d(Rotation3d::FromEuler(Vec3d(0, 15, 5)), Vec3d(0.5, -0.2, 0.3));
+	return Frustum(camera, Size(640, 480), 1, 15, pose);
+}
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the batched point tests match the single point test
+ */
+TEST(Frustum_Test, batched_point_tests)
+{
+	// Setup
+	auto model = BuildModel();
+	auto frustum = BuildFrustum();
+	auto points = vector<Point3d>(); for (auto i = 0; i < model->VertexCount(); i++) points.push_back(model->GetLocation(i));
+
+	// Execute
+	auto mask = vector<uchar>(); frustum.Contains(points, mask);
+	auto soaMask = vector<uchar>(points.size()); frustum.Contains(&model->GetX()[0], &model->GetY()[0], &model->GetZ()[0], &soaMask[0], soaMask.size());
+	auto indices = vector<int>(); frustum.FindInside(points, indices);
+	auto modelIndices = vector<int>(); frustum.FindInside(model, modelIndices);
+
+	// Confirm
+	auto expected = vector<int>();
+	for (auto i = 0; i < (int)points.size(); i++)
+	{
+		auto inside = frustum.Contains(points[i]);
+		ASSERT_EQ(mask[i], inside ? 1 : 0);
+		ASSERT_EQ(soaMask[i], inside ? 1 : 0);
+		if (inside) expected.push_back(i);
+	}
+
+	ASSERT_FALSE(expected.empty());
+	ASSERT_LT(expected.size(), points.size());
+	ASSERT_EQ(indices, expected);
+	ASSERT_EQ(modelIndices, expected);
+
+	// Teardown
+	delete model;
+}
+
+/**
+ * @brief Confirm that the fixed size constructor matches the matrix constructor
+ */
+TEST(Frustum_Test, fixed_size_construction)
+{
+	// Setup
+	auto pose = Pose3d(Rotation3d::FromEuler(Vec3d(0, 15, 5)), Vec3d(0.5, -0.2, 0.3));
+	Mat camera = (Mat_<double>(3, 3) << 500, 0, 320, 0, 500, 240, 0, 0, 1);
+	Mat poseMat = pose.ToMat();
+
+	// Execute
+	auto expected = Frustum(camera, Size(640, 480), 1, 15, poseMat);
+	auto actual = BuildFrustum();
+
+	// Confirm
+	ASSERT_EQ(actual.GetPlanes().size(), (size_t)6);
+	for (auto i = 0; i < 6; i++) for (auto j = 0; j < 4; j++) ASSERT_NEAR(actual.GetPlanes()[i][j], expected.GetPlanes()[i][j], 1e-12);
+}
+
+/**
+ * @brief Confirm that a frustum that starts at the camera has well formed planes, and that invalid clipping distances
+ * are rejected
+ */
+TEST(Frustum_Test, zero_near_distance)
+{
+	// Setup
+	auto camera = PinholeCamera(500, 500, 320, 240);
+	auto pose = Pose3d(Rotation3d::FromEuler(Vec3d(0, 15, 5)), Vec3d(0.5, -0.2, 0.3));
+	auto inverse = pose.Inverse();
+
+	// Execute
+	auto frustum = Frustum(camera, Size(640, 480), 0, 15, pose);
+	auto reference = BuildFrustum();
+
+	// Confirm
+	for (auto& plane : frustum.GetPlanes()) for (auto j = 0; j < 4; j++) ASSERT_TRUE(std::isfinite(plane[j]));
+	for (auto i = 1; i < 6; i++) for (auto j = 0; j < 4; j++) ASSERT_NEAR(frustum.GetPlanes()[i][j], reference.GetPlanes()[i][j], 1e-9);
+
+	ASSERT_TRUE(frustum.Contains(inverse.Apply(Point3d(0, 0, 0.5))));
+	ASSERT_TRUE(frustum.Contains(inverse.Apply(Point3d(0.1, -0.1, 14))));
+	ASSERT_FALSE(frustum.Contains(inverse.Apply(Point3d(0, 0, -0.5))));
+	ASSERT_FALSE(frustum.Contains(inverse.Apply(Point3d(2, 0, 1))));
+	ASSERT_FALSE(reference.Contains(inverse.Apply(Point3d(0, 0, 0.5))));
+
+	ASSERT_THROW(Frustum(camera, Size(640, 480), -1, 15, pose), runtime_error);
+	ASSERT_THROW(Frustum(camera, Size(640, 480), 15, 15, pose), runtime_error);
+}
+
+/**
+ * @brief Confirm that models and scene instances outside the view are culled by their bounds
+ */
+TEST(Frustum_Test, model_and_scene_culling)
+{
+	// Setup
+	auto frustum = Frustum(PinholeCamera(500, 500, 320, 240), Size(640, 480), 1, 20, Pose3d());
+
+	auto model = new Model();
+	for (auto i = 0; i < 8; i++) model->AddVertex(Point3d(i & 1 ? 0.5 : -0.5, i & 2 ? 0.5 : -0.5, i & 4 ? 0.5 : -0.5), Vec3i());
+
+	auto scene = new Scene(); auto modelId = scene->AddModel(model);
+	for (auto i = 0; i < 20; i++)
+	{
+		Mat pose = Mat_<double>::eye(4, 4); pose.at<double>(0, 3) = i * 2; pose.at<double>(2, 3) = 10;
+		scene->AddInstance(modelId, pose);
+	}
+
+	// Execute (with the shared model bounds not yet cached, so that culling has to find them)
+	model->InvalidateBounds();
+	auto instances = vector<int>(); frustum.FindVisible(scene, instances);
+
+	// Confirm
+	ASSERT_FALSE(instances.empty());
+	ASSERT_EQ(instances[0], 0);
+
+	for (auto i = 0; i < scene->InstanceCount(); i++)
+	{
+		auto visible = find(instances.begin(), instances.end(), i) != instances.end();
+		ASSERT_EQ(visible, frustum.IntersectsBox(scene->GetInstanceBounds(i)));
+	}
+
+	ASSERT_LT((int)instances.size(), scene->InstanceCount());
+	ASSERT_FALSE(frustum.IntersectsModel(model));
+
+	// Teardown
+	delete scene;
+}
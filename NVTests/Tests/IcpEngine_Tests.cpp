@@ -0,0 +1,156 @@
+//--------------------------------------------------
+// Unit Tests for class IcpEngine
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/Refiner/IcpEngine.h>
+using namespace NVLib;
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Build an organized cloud of a bumpy surface in front of the camera
+ * @param size The width and height of the cloud
+ * @return Mat The resultant CV_64FC(6) cloud
+ */
+static Mat BuildSurface(int size)
+{
+	Mat result = Mat(size, size, CV_64FC(6));
+
+	for (auto row = 0; row < size; row++)
+	{
+		for (auto column = 0; column < size; column++)
+		{
+			auto x = (column - (size - 1) * 0.5) / size; auto y = (row - (size - 1) * 0.5) / size;
+			auto z = 1.0 + 0.1 * sin(6 * x) * cos(6 * y);
+			auto point = result.ptr<double>(row) + column * 6;
+			point[0] = x * z; point[1] = y * z; point[2] = z;
+			point[3] = point[4] = point[5] = 128;
+		}
+	}
+
+	return result;
+}
+
+/**
+ * @brief Move the points of a cloud by a given pose
+ * @param cloud The cloud that we are moving
+ * @param pose The pose that we are moving it by
+ * @return Mat The resultant cloud
+ */
+static Mat MoveCloud(Mat& cloud, const Matx44d& pose)
+{
+	Mat result = cloud.clone();
+
+	for (auto row = 0; row < cloud.rows; row++)
+	{
+		for (auto column = 0; column < cloud.cols; column++)
+		{
+			auto point = result.ptr<double>(row) + column * 6;
+			auto moved = pose * Vec4d(point[0], point[1], point[2], 1);
+			point[0] = moved[0]; point[1] = moved[1]; point[2] = moved[2];
+		}
+	}
+
+	return result;
+}
+
+/**
+ * @brief Confirm that a pose matches the expected pose
+ * @param actual The pose that was found
+ * @param expected The pose that we expected
+ * @param tolerance The allowed difference in each element
+ */
+static void ConfirmPose(Mat& actual, const Matx44d& expected, double tolerance)
+{
+	ASSERT_EQ(actual.rows, 4); ASSERT_EQ(actual.cols, 4);
+	auto data = (double *)actual.data;
+	for (auto i = 0; i < 16; i++) ASSERT_NEAR(data[i], expected.val[i], tolerance);
+}
+
+/**
+ * @brief Invert a rigid pose
+ * @param pose The pose that we are inverting
+ * @return Matx44d The inverted pose
+ */
+static Matx44d Invert(const Matx44d& pose)
+{
+	auto result = Matx44d::eye();
+
+	for (auto row = 0; row < 3; row++)
+	{
+		for (auto column = 0; column < 3; column++) result(row, column) = pose(column, row);
+		result(row, 3) = -(pose(0, row) * pose(0, 3) + pose(1, row) * pose(1, 3) + pose(2, row) * pose(2, 3));
+	}
+
+	return result;
+}
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that a small known motion is recovered with the point-to-plane metric
+ */
+TEST(IcpEngine_Test, point_to_plane_recovers_motion)
+{
+	// Setup
+	Mat expected = PoseUtils::Vectors2Pose(Vec3d(0.02, -0.03, 0.01), Vec3d(0.01, 0.02, -0.015));
+	Mat target = BuildSurface(64); Mat source = MoveCloud(target, Invert(Matx44d(expected)));
+	Mat initial = Mat::eye(4, 4, CV_64F);
+	auto engine = IcpEngine(IcpMetric::PointToPlane, 30, 0.1, 1e-9);
+
+	// Execute
+	Mat pose = engine.Align(source, target, initial);
+
+	// Confirm
+	ConfirmPose(pose, Matx44d(expected), 1e-3);
+	ASSERT_FALSE(engine.GetHistory().empty());
+	ASSERT_LT(engine.GetHistory().back().GetRmse(), 1e-3);
+}
+
+/**
+ * @brief Confirm that a small known motion is recovered with the point-to-point metric
+ */
+TEST(IcpEngine_Test, point_to_point_recovers_motion)
+{
+	// Setup
+	Mat expected = PoseUtils::Vectors2Pose(Vec3d(0.01, 0.02, -0.01), Vec3d(-0.01, 0.005, 0.01));
+	Mat target = BuildSurface(64); Mat source = MoveCloud(target, Invert(Matx44d(expected)));
+	Mat initial = Mat::eye(4, 4, CV_64F);
+	auto engine = IcpEngine(IcpMetric::PointToPoint, 100, 0.1, 1e-10);
+	engine.GetLevels() = vector<int> { 1 };
+
+	// Execute
+	Mat pose = engine.Align(source, target, initial);
+
+	// Confirm
+	ConfirmPose(pose, Matx44d(expected), 2e-3);
+}
+
+/**
+ * @brief Confirm that projective association is used when the camera is known
+ */
+TEST(IcpEngine_Test, projective_association)
+{
+	// Setup
+	Mat expected = PoseUtils::Vectors2Pose(Vec3d(0.005, -0.005, 0.0), Vec3d(0.005, 0.0, 0.005));
+	Mat target = BuildSurface(64); Mat source = MoveCloud(target, Invert(Matx44d(expected)));
+	Mat initial = Mat::eye(4, 4, CV_64F);
+	auto engine = IcpEngine(IcpMetric::PointToPlane, 30, 0.1, 1e-9);
+	engine.GetCamera() = (Mat_<double>(3, 3) << 64, 0, 31.5, 0, 64, 31.5, 0, 0, 1);
+
+	// Execute
+	Mat pose = engine.Align(source, target, initial);
+
+	// Confirm
+	ConfirmPose(pose, Matx44d(expected), 2e-3);
+}
@@ -0,0 +1,106 @@
+//--------------------------------------------------
+// Unit Tests for class KdTree
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/Spatial/KdTree.h>
+using namespace NVLib;
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Build a pseudo random set of points
+ * @param count The number of points
+ * @param points The resultant points
+ */
+static void BuildPoints(int count, vector<Point3d>& points)
+{
+	auto rng = RNG(42);
+	for (auto i = 0; i < count; i++) points.push_back(Point3d(rng.uniform(-1.0, 1.0), rng.uniform(-1.0, 1.0), rng.uniform(-1.0, 1.0)));
+}
+
+/**
+ * @brief Find the distance between two points
+ */
+static double Distance(const Point3d& point1, const Point3d& point2)
+{
+	auto delta = point1 - point2;
+	return sqrt(delta.dot(delta));
+}
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the k nearest neighbours match a brute force search
+ */
+TEST(KdTree_Test, nearest_matches_brute_force)
+{
+	// Setup
+	auto points = vector<Point3d>(); BuildPoints(5000, points);
+	auto queries = vector<Point3d>(); BuildPoints(50, queries);
+	auto tree = KdTree(points);
+
+	// Execute
+	Mat indices, distances; tree.FindNearest(queries, 5, indices, distances);
+
+	// Confirm
+	for (auto i = 0; i < (int)queries.size(); i++)
+	{
+		auto expected = vector<double>();
+		for (auto& point : points) expected.push_back(Distance(point, queries[i]));
+		sort(expected.begin(), expected.end());
+
+		for (auto j = 0; j < 5; j++)
+		{
+			ASSERT_NEAR(distances.at<float>(i, j), expected[j], 1e-5);
+			ASSERT_NEAR(Distance(points[indices.at<int>(i, j)], queries[i]), expected[j], 1e-5);
+		}
+	}
+}
+
+/**
+ * @brief Confirm that a radius search finds exactly the points within the radius
+ */
+TEST(KdTree_Test, radius_matches_brute_force)
+{
+	// Setup
+	auto points = vector<Point3d>(); BuildPoints(5000, points);
+	auto tree = KdTree(points);
+	auto query = Point3d(0.1, -0.2, 0.3);
+
+	// Execute
+	auto indices = vector<int>(); auto distances = vector<float>();
+	tree.FindRadius(query, 0.25, indices, distances);
+
+	// Confirm
+	auto expected = 0;
+	for (auto& point : points) if (Distance(point, query) <= 0.25) expected++;
+	ASSERT_EQ((int)indices.size(), expected);
+	for (auto index : indices) ASSERT_LE(Distance(points[index], query), 0.25 + 1e-6);
+}
+
+/**
+ * @brief Confirm that asking for no nearest points is rejected
+ */
+TEST(KdTree_Test, reject_invalid_k)
+{
+	// Setup
+	auto points = vector<Point3d>(); BuildPoints(100, points);
+	auto tree = KdTree(points);
+	auto indices = vector<int>(); auto distances = vector<float>();
+	Mat indexMat, distanceMat;
+
+	// Execute and Confirm
+	ASSERT_THROW(tree.FindNearest(Point3d(0, 0, 0), 0, indices, distances), runtime_error);
+	ASSERT_THROW(tree.FindNearest(Point3d(0, 0, 0), -1, indices, distances), runtime_error);
+	ASSERT_THROW(tree.FindNearest(points, 0, indexMat, distanceMat), runtime_error);
+}
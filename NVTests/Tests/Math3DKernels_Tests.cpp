@@ -0,0 +1,223 @@
+//--------------------------------------------------
+// Unit Tests for the batched Math3D kernels
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <random>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include <NVLib/Math3D.h>
+using namespace NVLib;
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve the kernels that are built and supported by the processor running the tests
+ * @return vector<Math3DKernelTable> The supported kernels
+ */
+static vector<Math3DKernelTable> GetSupportedTables()
+{
+	auto result = vector<Math3DKernelTable> { Math3DKernels::Get() };
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+	auto table = Math3DKernelTable();
+	if (__builtin_cpu_supports("sse2") && Math3DKernels::GetSse2(table)) result.push_back(table);
+	if (__builtin_cpu_supports("avx2") && Math3DKernels::GetAvx2(table)) result.push_back(table);
+	if (__builtin_cpu_supports("avx512f") && Math3DKernels::GetAvx512(table)) result.push_back(table);
+#endif
+
+	return result;
+}
+
+/**
+ * @brief Build a set of random values
+ * @param count The number of values
+ * @param low The lowest value
+ * @param high The highest value
+ * @param seed The seed of the generator
+ * @return vector<double> The resultant values
+ */
+static vector<double> BuildValues(size_t count, double low, double high, int seed)
+{
+	auto generator = mt19937(seed); auto distribution = uniform_real_distribution<double>(low, high);
+	auto result = vector<double>(count);
+	for (auto& value : result) value = distribution(generator);
+	return result;
+}
+
+/**
+ * @brief Confirm that two arrays are bit identical
+ * @param expected The expected values
+ * @param actual The actual values
+ * @param name The name of the kernels being tested
+ */
+template <typename T> static void ConfirmIdentical(const vector<T>& expected, const vector<T>& actual, const char * name)
+{
+	ASSERT_EQ(expected.size(), actual.size());
+	ASSERT_EQ(memcmp(expected.data(), actual.data(), expected.size() * sizeof(T)), 0) << name;
+}
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that every supported instruction set gives the same bits as the scalar kernels (including the tails)
+ */
+TEST(Math3DKernels_Test, kernels_match_scalar)
+{
+	// Setup
+	const size_t count = 1003;
+	auto x = BuildValues(count, -2, 2, 1); auto y = BuildValues(count, -2, 2, 2); auto z = BuildValues(count, 0.5, 10, 3);
+	auto xf = vector<float>(x.begin(), x.end()); auto yf = vector<float>(y.begin(), y.end()); auto zf = vector<float>(z.begin(), z.end());
+	auto aos = vector<double>(count * 3); for (size_t i = 0; i < count; i++) { aos[i * 3] = x[i]; aos[i * 3 + 1] = y[i]; aos[i * 3 + 2] = z[i]; }
+
+	double K[] = { 525.3, 524.1, 319.7, 241.2 }; float Kf[] = { 525.3f, 524.1f, 319.7f, 241.2f };
+	double P[] = { 0.36, 0.48, -0.8, 0.1, -0.8, 0.6, 0, -0.2, 0.48, 0.64, 0.6, 1.5 };
+	float Pf[12]; for (auto i = 0; i < 12; i++) Pf[i] = (float)P[i];
+	double planes[] = { 0.6, 0.8, 0, 0.1, -1, 0, 0, 1.5, 0, 0, -1, 6 };
+
+	// Execute
+	auto run = [&](const Math3DKernelTable& table)
+	{
+		auto result = vector<vector<double>>(10, vector<double>(count * 3));
+		auto resultf = vector<vector<float>>(7, vector<float>(count));
+
+		table.ProjectAoS(K, aos.data(), result[0].data(), count);
+		table.Project64(K, x.data(), y.data(), z.data(), result[1].data(), result[2].data(), count);
+		table.UnProjectAoS(K, result[0].data(), z.data(), result[3].data(), count);
+		table.UnProject64(K, result[1].data(), result[2].data(), z.data(), result[4].data(), result[5].data(), count);
+		table.TransformAoS(P, aos.data(), result[6].data(), count);
+		table.Transform64(P, x.data(), y.data(), z.data(), result[7].data(), result[8].data(), result[9].data(), count);
+		result.push_back(vector<double> { DBL_MAX, -DBL_MAX, DBL_MAX, -DBL_MAX, DBL_MAX, -DBL_MAX }); table.BoundsAoS(aos.data(), count, result[10].data());
+		result.push_back(vector<double> { DBL_MAX, -DBL_MAX, DBL_MAX, -DBL_MAX, DBL_MAX, -DBL_MAX }); table.Bounds64(x.data(), y.data(), z.data(), count, result[11].data());
+
+		auto maskAoS = vector<uchar>(count); table.InsideAoS(planes, 3, aos.data(), count, maskAoS.data());
+		auto mask64 = vector<uchar>(count); table.Inside64(planes, 3, x.data(), y.data(), z.data(), count, mask64.data());
+		result.push_back(vector<double>(maskAoS.begin(), maskAoS.end())); result.push_back(vector<double>(mask64.begin(), mask64.end()));
+
+		table.Project32(Kf, xf.data(), yf.data(), zf.data(), resultf[0].data(), resultf[1].data(), count);
+		table.UnProject32(Kf, resultf[0].data(), resultf[1].data(), zf.data(), resultf[2].data(), resultf[3].data(), count);
+		table.Transform32(Pf, xf.data(), yf.data(), zf.data(), resultf[4].data(), resultf[5].data(), resultf[6].data(), count);
+
+		return make_pair(result, resultf);
+	};
+
+	auto expected = run(Math3DKernels::GetScalar());
+
+	// Confirm
+	for (auto& table : GetSupportedTables())
+	{
+		auto actual = run(table);
+		for (auto i = 0; i < (int)expected.first.size(); i++) ConfirmIdentical(expected.first[i], actual.first[i], table.Name);
+		for (auto i = 0; i < (int)expected.second.size(); i++) ConfirmIdentical(expected.second[i], actual.second[i], table.Name);
+	}
+}
+
+/**
+ * @brief Confirm that the batched operations give the same bits as the single point operations
+ */
+TEST(Math3DKernels_Test, batch_matches_single_point)
+{
+	// Setup
+	Mat camera = Math3D::BuildKMatrix(525, Size(640, 480));
+	Mat pose = (Mat_<double>(4, 4) << 0.36, 0.48, -0.8, 0.1, -0.8, 0.6, 0, -0.2, 0.48, 0.64, 0.6, 1.5, 0, 0, 0, 1);
+	auto x = BuildValues(37, -2, 2, 4); auto y = BuildValues(37, -2, 2, 5); auto z = BuildValues(37, 0.5, 10, 6);
+	auto points = vector<Point3d>(); for (auto i = 0; i < 37; i++) points.push_back(Point3d(x[i], y[i], z[i]));
+
+	// Execute
+	auto transformed = vector<Point3d>(points.size()); Math3D::TransformPoints(pose, &points[0], &transformed[0], points.size());
+	auto projected = vector<Point2d>(); Math3D::ProjectPoints(camera, transformed, projected);
+	auto depths = vector<double>(); for (auto& point : transformed) depths.push_back(point.z);
+	auto restored = vector<Point3d>(points.size()); Math3D::UnProjectPoints(camera, &projected[0], &depths[0], &restored[0], points.size());
+
+	// Confirm
+	for (auto i = 0; i < (int)points.size(); i++)
+	{
+		auto expectedPoint = Math3D::TransformPoint(pose, points[i]);
+		auto expectedImage = Math3D::Project(camera, expectedPoint);
+		auto expectedRestored = Math3D::UnProject(camera, expectedImage, expectedPoint.z);
+
+		ASSERT_EQ(transformed[i].x, expectedPoint.x); ASSERT_EQ(transformed[i].y, expectedPoint.y); ASSERT_EQ(transformed[i].z, expectedPoint.z);
+		ASSERT_EQ(projected[i].x, expectedImage.x); ASSERT_EQ(projected[i].y, expectedImage.y);
+		ASSERT_EQ(restored[i].x, expectedRestored.x); ASSERT_EQ(restored[i].y, expectedRestored.y); ASSERT_EQ(restored[i].z, expectedRestored.z);
+		ASSERT_NEAR(restored[i].x, expectedPoint.x, 1e-9); ASSERT_NEAR(restored[i].y, expectedPoint.y, 1e-9);
+	}
+}
+
+/**
+ * @brief Confirm that large point sets (split across threads) are transformed in and out of place
+ */
+TEST(Math3DKernels_Test, transform_point_set_parallel)
+{
+	// Setup
+	const size_t count = 100003;
+	Mat pose = (Mat_<double>(4, 4) << 0.36, 0.48, -0.8, 0.1, -0.8, 0.6, 0, -0.2, 0.48, 0.64, 0.6, 1.5, 0, 0, 0, 1);
+	auto x = BuildValues(count, -2, 2, 7); auto y = BuildValues(count, -2, 2, 8); auto z = BuildValues(count, 0.5, 10, 9);
+	auto points = vector<Point3d>(); for (size_t i = 0; i < count; i++) points.push_back(Point3d(x[i], y[i], z[i]));
+	auto xf = vector<float>(x.begin(), x.end()); auto yf = vector<float>(y.begin(), y.end()); auto zf = vector<float>(z.begin(), z.end());
+
+	float Pf[12]; for (auto i = 0; i < 12; i++) Pf[i] = (float)((double *)pose.data)[i];
+	auto expectedX = vector<float>(count); auto expectedY = vector<float>(count); auto expectedZ = vector<float>(count);
+	Math3DKernels::GetScalar().Transform32(Pf, xf.data(), yf.data(), zf.data(), expectedX.data(), expectedY.data(), expectedZ.data(), count);
+
+	// Execute
+	auto output = vector<Point3d>(5, Point3d()); Math3D::TransformPointSet(pose, points, output);
+	auto inPlace = points; Math3D::TransformPointSet(pose, inPlace);
+	Math3D::TransformPointSet(pose, xf, yf, zf);
+
+	// Confirm
+	ASSERT_EQ(output.size(), count);
+	for (size_t i = 0; i < count; i++)
+	{
+		auto expected = Math3D::TransformPoint(pose, points[i]);
+		ASSERT_EQ(output[i].x, expected.x); ASSERT_EQ(output[i].y, expected.y); ASSERT_EQ(output[i].z, expected.z);
+		ASSERT_EQ(inPlace[i].x, expected.x); ASSERT_EQ(inPlace[i].y, expected.y); ASSERT_EQ(inPlace[i].z, expected.z);
+	}
+
+	ConfirmIdentical(expectedX, xf, "SoA"); ConfirmIdentical(expectedY, yf, "SoA"); ConfirmIdentical(expectedZ, zf, "SoA");
+}
+
+/**
+ * @brief Confirm the axis aligned bounds of a large point set, and the oriented bounds of a rotated box
+ */
+TEST(Math3DKernels_Test, cloud_bounds)
+{
+	// Setup
+	const size_t count = 100003;
+	auto x = BuildValues(count, -3, 3, 10); auto y = BuildValues(count, -1, 1, 11); auto z = BuildValues(count, -0.5, 0.5, 12);
+	auto rotation = Rotation3d::FromEuler(Vec3d(30, -20, 45)); auto offset = Vec3d(4, -2, 7);
+
+	auto points = vector<Point3d>(); auto expected = Vec6d(DBL_MAX, -DBL_MAX, DBL_MAX, -DBL_MAX, DBL_MAX, -DBL_MAX);
+	for (size_t i = 0; i < count; i++)
+	{
+		auto point = rotation.Apply(Vec3d(x[i], y[i], z[i])) + offset; points.push_back(Point3d(point));
+		for (auto j = 0; j < 3; j++) { expected[j * 2] = min(expected[j * 2], point[j]); expected[j * 2 + 1] = max(expected[j * 2 + 1], point[j]); }
+	}
+
+	// Execute
+	auto bounds = Math3D::GetCloudBounds(points);
+	auto emptyBounds = Math3D::GetCloudBounds(vector<Point3d>());
+	Point3d center; Matx33d axes; Vec3d extents; Math3D::GetOrientedBounds(points, center, axes, extents);
+
+	// Confirm
+	for (auto i = 0; i < 6; i++) { ASSERT_EQ(bounds[i], expected[i]); ASSERT_EQ(emptyBounds[i], 0); }
+
+	auto expectedExtents = Vec3d(3, 1, 0.5);
+	for (auto i = 0; i < 3; i++)
+	{
+		auto axis = Vec3d(axes(i, 0), axes(i, 1), axes(i, 2)); auto column = rotation.Apply(Vec3d(i == 0, i == 1, i == 2));
+		ASSERT_NEAR(fabs(axis.dot(column)), 1, 1e-3);
+		ASSERT_NEAR(extents[i], expectedExtents[i], 1e-2);
+		ASSERT_NEAR(center.x, offset[0], 1e-2); ASSERT_NEAR(center.y, offset[1], 1e-2); ASSERT_NEAR(center.z, offset[2], 1e-2);
+	}
+
+	ASSERT_NEAR(determinant(axes), 1, 1e-9);
+}
@@ -0,0 +1,90 @@
+//--------------------------------------------------
+// Unit Tests for class Model
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/Model/Model.h>
+using namespace NVLib;
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the valid points of a cloud are added in bulk
+ */
+TEST(Model_Test, add_vertices_from_cloud)
+{
+	// Setup
+	Mat cloud = Mat::zeros(2, 3, CV_64FC(6));
+	for (auto i = 0; i < 6; i++) 
+	{
+		if (i == 2) continue;
+		auto point = ((double *)cloud.data) + i * 6;
+		point[0] = i; point[1] = -i; point[2] = 1 + i; point[3] = 10 * i; point[4] = 20 * i; point[5] = 30 * i;
+	}
+	auto model = Model(); model.Reserve(5);
+
+	// Execute
+	model.AddVertices(cloud);
+
+	// Confirm
+	ASSERT_EQ(model.VertexCount(), 5);
+	ASSERT_EQ(model.GetLocation(2).z, 4);
+	auto color = model.GetColor(2);
+	ASSERT_EQ(color[0], 30); ASSERT_EQ(color[1], 60); ASSERT_EQ(color[2], 90);
+}
+
+/**
+ * @brief Confirm that a transform is applied to every vertex
+ */
+TEST(Model_Test, transform)
+{
+	// Setup
+	auto model = Model();
+	auto locations = vector<Point3d>(); auto colors = vector<Vec3b>();
+	for (auto i = 0; i < 1000; i++) { locations.push_back(Point3d(i, 2 * i, 3 * i)); colors.push_back(Vec3b(1, 2, 3)); }
+	model.AddVertices(locations, colors);
+	Mat transform = (Mat_<double>(3, 4) << 0, -1, 0, 1, 1, 0, 0, 2, 0, 0, 1, 3);
+
+	// Execute
+	model.Transform(transform);
+
+	// Confirm
+	for (auto i = 0; i < model.VertexCount(); i++)
+	{
+		auto location = model.GetLocation(i);
+		ASSERT_EQ(location.x, -2 * i + 1); ASSERT_EQ(location.y, i + 2); ASSERT_EQ(location.z, 3 * i + 3);
+	}
+}
+
+/**
+ * @brief Confirm that the cached bounds follow edits to the vertices, and can be requested from several threads
+ */
+TEST(Model_Test, cached_bounds)
+{
+	// Setup
+	auto model = Model();
+	for (auto i = 0; i < 100000; i++) model.AddVertex(Point3d(i % 100, -(i % 7), i * 0.5), Vec3i(1, 2, 3));
+
+	// Execute
+	auto bounds = vector<Vec6d>(64);
+	parallel_for_(cv::Range(0, (int)bounds.size()), [&](const cv::Range& range)
+	{
+		for (auto i = range.start; i < range.end; i++) bounds[i] = model.GetBounds();
+	});
+
+	double * x; double * y; double * z; Vec3b * colors; model.EditVertices(x, y, z, colors);
+	x[10] = 500; z[20] = -1;
+	auto edited = model.GetBounds();
+
+	// Confirm
+	auto expected = Vec6d(0, 99, -6, 0, 0, 49999.5); auto expectedEdited = Vec6d(0, 500, -6, 0, -1, 49999.5);
+	for (auto& value : bounds) for (auto i = 0; i < 6; i++) ASSERT_EQ(value[i], expected[i]);
+	for (auto i = 0; i < 6; i++) ASSERT_EQ(edited[i], expectedEdited[i]);
+}
@@ -0,0 +1,100 @@
+//--------------------------------------------------
+// Unit Tests for class NormalUtils
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/NormalUtils.h>
+using namespace NVLib;
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Build an organized cloud of the plane z = 1 + 0.5x - 0.25y, with an invalid pixel in the middle
+ * @param size The size of the cloud
+ * @return Mat The resultant CV_64FC(6) cloud
+ */
+static Mat BuildPlane(const Size& size)
+{
+	Mat result = Mat::zeros(size, CV_64FC(6));
+
+	for (auto row = 0; row < size.height; row++)
+	{
+		for (auto column = 0; column < size.width; column++)
+		{
+			if (row == size.height / 2 && column == size.width / 2) continue;
+			auto x = column * 0.01; auto y = row * 0.01;
+			auto point = result.ptr<double>(row) + column * 6;
+			point[0] = x; point[1] = y; point[2] = 1 + 0.5 * x - 0.25 * y;
+		}
+	}
+
+	return result;
+}
+
+/**
+ * @brief Confirm that a normal map matches the normal of the plane
+ * @param normals The normal map that we are checking
+ */
+static void ConfirmPlaneNormals(Mat& normals)
+{
+	auto expected = Vec3d(0.5, -0.25, -1); expected *= 1.0 / sqrt(expected.dot(expected));
+
+	for (auto row = 0; row < normals.rows; row++)
+	{
+		for (auto column = 0; column < normals.cols; column++)
+		{
+			auto normal = normals.at<Vec3f>(row, column);
+
+			if (row == normals.rows / 2 && column == normals.cols / 2)
+			{
+				for (auto i = 0; i < 3; i++) ASSERT_EQ(normal[i], 0.0f);
+				continue;
+			}
+
+			for (auto i = 0; i < 3; i++) ASSERT_NEAR(normal[i], expected[i], 1e-4);
+		}
+	}
+}
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that central differences recover the normal of a plane
+ */
+TEST(NormalUtils_Test, central_normals_of_plane)
+{
+	// Setup
+	Mat cloud = BuildPlane(Size(20, 15));
+
+	// Execute
+	Mat normals; NormalUtils::GetNormals(cloud, normals);
+
+	// Confirm
+	ASSERT_EQ(normals.type(), CV_32FC3);
+	ConfirmPlaneNormals(normals);
+}
+
+/**
+ * @brief Confirm that the integral image covariance recovers the normal of a plane
+ */
+TEST(NormalUtils_Test, covariance_normals_of_plane)
+{
+	// Setup
+	Mat cloud = BuildPlane(Size(20, 15));
+
+	// Execute
+	Mat normals; NormalUtils::GetNormals(cloud, normals, 2);
+
+	// Confirm
+	ASSERT_EQ(normals.type(), CV_32FC3);
+	ConfirmPlaneNormals(normals);
+}
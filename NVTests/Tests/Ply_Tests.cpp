@@ -0,0 +1,245 @@
+//--------------------------------------------------
+// Unit Tests for the PLY reader and writer
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/FileUtils.h>
+#include <NVLib/SaveUtils.h>
+#include <NVLib/LoadUtils.h>
+#include <NVLib/CloudUtils.h>
+#include <NVLib/Ply/PlyReader.h>
+#include <NVLib/Ply/PlyWriter.h>
+#include <NVLib/Ply/PlyStreamWriter.h>
+using namespace NVLib;
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Build a test model
+ * @return Model* The resultant model
+ */
+static Model * BuildModel()
+{
+	auto result = new Model();
+	for (auto i = 0; i < 100; i++) result->AddVertex(Point3d(i * 0.5, -i * 0.25, 1 + i), Vec3i(i, 2 * i, 255 - i));
+	return result;
+}
+
+/**
+ * @brief Confirm that two models match
+ * @param expected The expected model
+ * @param actual The actual model
+ */
+static void ConfirmModel(Model * expected, Model * actual)
+{
+	ASSERT_EQ(expected->VertexCount(), actual->VertexCount());
+
+	for (auto i = 0; i < expected->VertexCount(); i++)
+	{
+		auto expectedVertex = expected->GetVertex(i); auto actualVertex = actual->GetVertex(i);
+		ASSERT_NEAR(expectedVertex.GetLocation().x, actualVertex.GetLocation().x, 1e-4);
+		ASSERT_NEAR(expectedVertex.GetLocation().y, actualVertex.GetLocation().y, 1e-4);
+		ASSERT_NEAR(expectedVertex.GetLocation().z, actualVertex.GetLocation().z, 1e-4);
+		for (auto j = 0; j < 3; j++) ASSERT_EQ(expectedVertex.GetColor()[j], actualVertex.GetColor()[j]);
+	}
+}
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that a model survives an ascii round trip
+ */
+TEST(Ply_Test, model_ascii_round_trip)
+{
+	// Setup
+	auto expected = BuildModel();
+
+	// Execute
+	SaveUtils::SaveModel("model_ascii.ply", expected);
+	auto actual = LoadUtils::LoadModel("model_ascii.ply");
+
+	// Confirm
+	ConfirmModel(expected, actual);
+
+	// Teardown
+	delete expected; delete actual;
+	FileUtils::Remove("model_ascii.ply");
+}
+
+/**
+ * @brief Confirm that a model (with normals) survives a binary round trip
+ */
+TEST(Ply_Test, model_binary_round_trip)
+{
+	// Setup
+	auto expected = BuildModel();
+	auto normals = vector<Vec3d>(expected->VertexCount(), Vec3d(0, 0, 1));
+
+	// Execute
+	SaveUtils::SaveModel("model_binary.ply", expected, normals, true, true);
+	auto actual = LoadUtils::LoadModel("model_binary.ply");
+
+	// Confirm
+	ConfirmModel(expected, actual);
+
+	auto reader = PlyReader("model_binary.ply");
+	ASSERT_TRUE(reader.IsBinary());
+	ASSERT_TRUE(reader.HasProperty("nz"));
+	ASSERT_EQ(reader.GetVertexCount(), expected->VertexCount());
+
+	Mat values; reader.ReadProperties(vector<string> { "nz", "missing" }, values);
+	for (auto i = 0; i < values.rows; i++) { ASSERT_EQ(values.at<double>(i, 0), 1); ASSERT_EQ(values.at<double>(i, 1), 0); }
+
+	// Teardown
+	delete expected; delete actual;
+	FileUtils::Remove("model_binary.ply");
+}
+
+/**
+ * @brief Confirm that the valid points of a cloud survive a binary round trip
+ */
+TEST(Ply_Test, cloud_binary_round_trip)
+{
+	// Setup
+	Mat camera = Math3D::BuildKMatrix(500, Size(20, 10));
+	Mat color = Mat_<Vec3b>(10, 20); for (auto i = 0; i < 600; i++) color.data[i] = (uchar)(i % 256);
+	Mat depth = Mat_<ushort>(10, 20); for (auto i = 0; i < 200; i++) ((ushort *)depth.data)[i] = i % 3 == 0 ? 0 : 1000 + i;
+	Mat cloud; CloudUtils::BuildColorCloud(camera, color, depth, cloud, 1e-3);
+
+	// Execute
+	CloudUtils::Save("cloud_binary.ply", cloud, true);
+	Mat actual = LoadUtils::LoadCloud("cloud_binary.ply");
+
+	// Confirm
+	ASSERT_EQ(actual.rows, CloudUtils::GetVertexCount(cloud));
+	ASSERT_EQ(actual.type(), CV_64FC(6));
+
+	auto index = 0;
+	for (auto i = 0; i < (int)cloud.total(); i++)
+	{
+		auto expectedPoint = ((double *)cloud.data) + i * 6;
+		if (expectedPoint[2] == 0) continue;
+
+		auto actualPoint = ((double *)actual.data) + (index++) * 6;
+		for (auto j = 0; j < 6; j++) ASSERT_NEAR(expectedPoint[j], actualPoint[j], 1e-4);
+	}
+
+	// Teardown
+	FileUtils::Remove("cloud_binary.ply");
+}
+
+/**
+ * @brief Confirm that batches streamed through a small double buffer are all written, in order
+ */
+TEST(Ply_Test, stream_batches_round_trip)
+{
+	// Setup
+	auto model = BuildModel();
+	auto expected = new Model();
+	auto writer = new PlyStreamWriter("stream.ply", true, false, false, 1024);
+
+	// Execute
+	for (auto batch = 0; batch < 20; batch++)
+	{
+		writer->AddModel(model);
+		for (auto i = 0; i < model->VertexCount(); i++) expected->AddVertex(model->GetLocation(i), model->GetColor(i));
+	}
+	writer->Close();
+	auto actual = LoadUtils::LoadModel("stream.ply");
+
+	// Confirm
+	ASSERT_EQ(writer->GetVertexCount(), expected->VertexCount());
+	ConfirmModel(expected, actual);
+
+	// Teardown
+	delete writer; delete model; delete expected; delete actual;
+	FileUtils::Remove("stream.ply");
+}
+
+/**
+ * @brief Confirm that a failed write is reported as an error (and that the writer can still be destroyed)
+ */
+TEST(Ply_Test, stream_write_failure)
+{
+	// Setup
+	auto model = BuildModel();
+
+	// Execute and Confirm
+	auto writer = new PlyStreamWriter("/dev/full", true, false, false, 1024);
+	ASSERT_THROW({ for (auto batch = 0; batch < 100; batch++) writer->AddModel(model); writer->Close(); }, runtime_error);
+	delete writer;
+
+	writer = new PlyStreamWriter("/dev/full", true, false, false, 1024);
+	try { for (auto batch = 0; batch < 100; batch++) writer->AddModel(model); } catch (const runtime_error&) { /* The destructor must still stop the thread */ }
+	delete writer;
+
+	// Teardown
+	delete model;
+}
+
+/**
+ * @brief Confirm that a write failure is reported by the buffered writer, rather than leaving a truncated file
+ */
+TEST(Ply_Test, write_failure)
+{
+	// Setup
+	auto writer = new PlyWriter("/dev/full", false, false, false, 1024);
+
+	// Execute and Confirm
+	ASSERT_THROW({ for (auto i = 0; i < 100000; i++) writer->AddVertex(Point3d(i, i, i), Vec3i(1, 2, 3)); writer->Close(); }, runtime_error);
+
+	// Teardown
+	delete writer;
+}
+
+/**
+ * @brief Confirm that the largest possible ascii vertex fits within the space reserved for a vertex
+ */
+TEST(Ply_Test, encode_large_values)
+{
+	// Setup
+	auto output = vector<char>(PlyWriter::MAX_VERTEX_SIZE + 1, '#');
+	auto location = Point3d(-1.2345678901234567e300, -DBL_MAX, -DBL_MIN); auto normal = Vec3d(-DBL_MAX, -DBL_MAX, -DBL_MAX);
+	auto color = Vec3i(INT_MIN, INT_MIN, INT_MIN);
+
+	for (auto doublePrecision : { false, true })
+	{
+		// Execute
+		auto length = PlyWriter::Encode(&output[0], PlyWriter::MAX_VERTEX_SIZE, false, doublePrecision, true, location, normal, color);
+
+		// Confirm
+		ASSERT_LT(length, PlyWriter::MAX_VERTEX_SIZE);
+		ASSERT_EQ(output[PlyWriter::MAX_VERTEX_SIZE], '#');
+	}
+}
+
+/**
+ * @brief Confirm that a binary file that ends before the count of a list is rejected, rather than read past its end
+ */
+TEST(Ply_Test, truncated_list_count)
+{
+	// Setup
+	auto writer = ofstream("truncated.ply", ios::out | ios::binary);
+	writer << "ply" << endl << "format binary_little_endian 1.0" << endl;
+	writer << "element face 2" << endl << "property list uchar int vertex_indices" << endl;
+	writer << "element vertex 1" << endl << "property float x" << endl << "end_header" << endl;
+	writer.put(1); auto index = 0; writer.write((const char *)&index, sizeof(int));
+	writer.close();
+
+	// Execute and Confirm
+	auto reader = PlyReader("truncated.ply");
+	Mat values; ASSERT_THROW(reader.ReadProperties(vector<string> { "x" }, values), runtime_error);
+	static_assert(!is_copy_constructible<PlyReader>::value, "The reader owns a mapping, so it must not be copied");
+
+	// Teardown
+	FileUtils::Remove("truncated.ply");
+}
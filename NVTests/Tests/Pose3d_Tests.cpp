@@ -0,0 +1,106 @@
+//--------------------------------------------------
+// Unit Tests for the fixed size pose and camera types
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/Math3D.h>
+#include <NVLib/PoseUtils.h>
+#include <NVLib/Model/Pose3d.h>
+#include <NVLib/Model/PinholeCamera.h>
+using namespace NVLib;
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that two points match
+ * @param expected The expected point
+ * @param actual The actual point
+ * @param tolerance The largest difference allowed
+ */
+static void ConfirmPoint(const Point3d& expected, const Point3d& actual, double tolerance)
+{
+	ASSERT_NEAR(expected.x, actual.x, tolerance);
+	ASSERT_NEAR(expected.y, actual.y, tolerance);
+	ASSERT_NEAR(expected.z, actual.z, tolerance);
+}
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that rotation vectors convert to the expected rotation and back (including angles close to pi)
+ */
+TEST(Pose3d_Test, rotation_vector_round_trip)
+{
+	// Setup
+	auto quarter = Rotation3d::FromVector(Vec3d(0, 0, CV_PI / 2));
+	auto vectors = vector<Vec3d> { Vec3d(0.1, -0.2, 0.3), Vec3d(1e-9, 0, 0), Vec3d(CV_PI - 1e-9, 0, 0), Vec3d(0, 2, 2) * (CV_PI / sqrt(8.0)) };
+
+	// Confirm
+	ConfirmPoint(Point3d(0, 1, 0), quarter.Apply(Point3d(1, 0, 0)), 1e-12);
+
+	for (auto& rvec : vectors)
+	{
+		auto actual = Rotation3d::FromVector(rvec).ToVector();
+		for (auto i = 0; i < 3; i++) ASSERT_NEAR(rvec[i], actual[i], 1e-6);
+	}
+}
+
+/**
+ * @brief Confirm that composition and inversion agree with the matrix based operations
+ */
+TEST(Pose3d_Test, compose_and_inverse)
+{
+	// Setup
+	auto pose1 = Pose3d(Rotation3d::FromEuler(Vec3d(40, -20, 10)), Vec3d(1, 2, 3));
+	auto pose2 = Pose3d::FromVectors(Vec3d(0.3, 0.1, -0.2), Vec3d(-0.5, 0.25, 2));
+	auto point = Point3d(0.7, -1.2, 4.5);
+
+	Mat matrix1 = pose1.ToMat(); Mat matrix2 = pose2.ToMat();
+
+	// Execute
+	auto composed = (pose1 * pose2).Apply(point);
+	auto restored = (pose1.Inverse() * pose1).Apply(point);
+	auto expected = Math3D::TransformPoint(matrix1, Math3D::TransformPoint(matrix2, point));
+
+	// Confirm
+	ConfirmPoint(expected, composed, 1e-12);
+	ConfirmPoint(point, restored, 1e-12);
+	ConfirmPoint(Math3D::TransformPoint(matrix1, point), Math3D::TransformPoint(pose1, point), 0);
+
+	auto rvec = Vec3d(); auto tvec = Vec3d(); PoseUtils::Pose2Vectors(matrix2, rvec, tvec);
+	ASSERT_NEAR(rvec[0], 0.3, 1e-12); ASSERT_NEAR(rvec[1], 0.1, 1e-12); ASSERT_NEAR(rvec[2], -0.2, 1e-12);
+	ASSERT_EQ(tvec[2], 2);
+}
+
+/**
+ * @brief Confirm that the fixed size camera projects in the same way as the camera matrix
+ */
+TEST(Pose3d_Test, pinhole_camera_matches_matrix)
+{
+	// Setup
+	Mat cameraMatrix = Math3D::BuildKMatrix(525, Size(640, 480));
+	auto camera = PinholeCamera::FromMat(cameraMatrix);
+	auto pose = Pose3d(Rotation3d::FromEuler(Vec3d(5, 10, -15)), Vec3d(0.1, 0.2, 1));
+	auto point = Point3d(0.3, -0.4, 2.5);
+
+	// Execute
+	auto expected = Math3D::Project(cameraMatrix, point);
+	auto actual = Math3D::Project(camera, point);
+	auto restored = Math3D::UnProject(camera, actual, point.z);
+	Mat poseMatrix = pose.ToMat(); auto projection1 = Math3D::GetProjection(cameraMatrix, poseMatrix);
+	auto projection2 = Math3D::GetProjection(camera, pose);
+
+	// Confirm
+	ASSERT_EQ(expected.x, actual.x); ASSERT_EQ(expected.y, actual.y);
+	ConfirmPoint(point, restored, 1e-12);
+	for (auto i = 0; i < 12; i++) ASSERT_NEAR(projection1.val[i], projection2.val[i], 1e-12);
+}
@@ -0,0 +1,67 @@
+//--------------------------------------------------
+// Unit Tests for the cache of camera rays
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/Math3D.h>
+#include <NVLib/Camera/RayCache.h>
+using namespace NVLib;
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that tables are shared between requests and that the least recently used table is evicted
+ */
+TEST(RayCache_Test, least_recently_used_eviction)
+{
+	// Setup
+	auto tableSize = (size_t)(40 * 30 * 16);
+	auto cache = RayCache(tableSize * 2);
+	Mat camera1 = Math3D::BuildKMatrix(500, Size(40, 30));
+	Mat camera2 = Math3D::BuildKMatrix(600, Size(40, 30));
+	Mat camera3 = Math3D::BuildKMatrix(700, Size(40, 30));
+
+	// Execute
+	auto rays1 = cache.GetRays(camera1, Size(40, 30));
+	auto rays2 = cache.GetRays(camera2, Size(40, 30));
+	auto again1 = cache.GetRays(camera1, Size(40, 30));
+	cache.GetRays(camera3, Size(40, 30));
+	auto rebuilt1 = cache.GetRays(camera1, Size(40, 30));
+	auto rebuilt2 = cache.GetRays(camera2, Size(40, 30));
+
+	// Confirm
+	ASSERT_EQ(rays1.data, again1.data);
+	ASSERT_EQ(rays1.data, rebuilt1.data);
+	ASSERT_NE(rays2.data, rebuilt2.data);
+	ASSERT_EQ(cache.GetCount(), (size_t)2);
+	ASSERT_EQ(cache.GetMemoryUsed(), tableSize * 2);
+
+	auto ray = rays1.at<Vec2d>(7, 11);
+	ASSERT_EQ(ray[0], (11 - 20.0) / 500); ASSERT_EQ(ray[1], (7 - 15.0) / 500);
+}
+
+/**
+ * @brief Confirm that a distorted camera is cached separately from its pinhole camera
+ */
+TEST(RayCache_Test, distortion_is_part_of_key)
+{
+	// Setup
+	auto cache = RayCache();
+	Mat camera = Math3D::BuildKMatrix(500, Size(40, 30));
+	Mat distortion = (Mat_<double>(1, 4) << -0.2, 0.05, 0, 0);
+
+	// Execute
+	auto pinhole = cache.GetRays(camera, Size(40, 30));
+	auto distorted = cache.GetRays(camera, distortion, Size(40, 30));
+
+	// Confirm
+	ASSERT_EQ(cache.GetCount(), (size_t)2);
+	ASSERT_NE(pinhole.at<Vec2d>(0, 0)[0], distorted.at<Vec2d>(0, 0)[0]);
+}
@@ -0,0 +1,103 @@
+//--------------------------------------------------
+// Unit Tests for class SceneRenderer
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/Math3D.h>
+#include <NVLib/Graphics/SceneRenderer.h>
+using namespace NVLib;
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Build a flat square patch of points that faces the camera
+ * @param color The color of the patch
+ * @return Model* The resultant model
+ */
+static Model * BuildPatch(const Vec3i& color)
+{
+	auto result = new Model();
+	for (auto y = -10; y <= 10; y++) for (auto x = -10; x <= 10; x++) result->AddVertex(Point3d(x * 0.002, y * 0.002, 0), color);
+	return result;
+}
+
+/**
+ * @brief Build a pose that is a pure translation
+ * @param x The translation along the x axis
+ * @param z The translation along the z axis
+ * @return Mat The resultant 4x4 pose
+ */
+static Mat BuildPose(double x, double z)
+{
+	Mat result = Mat_<double>::eye(4, 4);
+	result.at<double>(0, 3) = x; result.at<double>(2, 3) = z;
+	return result;
+}
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the nearest instance wins the z-buffer and that hidden instances are culled
+ */
+TEST(SceneRenderer_Test, nearest_instance_wins)
+{
+	// Setup
+	auto scene = Scene();
+	Mat pose1 = BuildPose(0, 2); Mat pose2 = BuildPose(0, 1); Mat pose3 = BuildPose(0, -5);
+	auto near = scene.AddModel(BuildPatch(Vec3i(0, 0, 255)), pose2);
+	auto far = scene.AddModel(BuildPatch(Vec3i(255, 0, 0)), pose1);
+	scene.AddInstance(scene.GetInstances()[far].GetModelId(), pose3);
+
+	Mat camera = Math3D::BuildKMatrix(500, Size(100, 100));
+	Mat pose = Mat_<double>::eye(4, 4);
+	auto renderer = SceneRenderer(camera, Size(100, 100), 0.1, 10, 3);
+
+	// Execute
+	Mat image, depth, idImage; renderer.Render(&scene, pose, image, depth, idImage);
+
+	// Confirm
+	ASSERT_EQ(idImage.at<int>(50, 50), near);
+	ASSERT_NEAR(depth.at<float>(50, 50), 1, 1e-6);
+	ASSERT_EQ(image.at<Vec3b>(50, 50)[2], 255);
+	ASSERT_EQ(idImage.at<int>(0, 0), -1);
+	ASSERT_EQ(depth.at<float>(0, 0), 0);
+}
+
+/**
+ * @brief Confirm that rendering through a hierarchy gives the same images as rendering the whole scene
+ */
+TEST(SceneRenderer_Test, bvh_matches_full_render)
+{
+	// Setup
+	auto scene = Scene();
+	auto modelId = scene.AddModel(BuildPatch(Vec3i(10, 20, 30)));
+	for (auto i = 0; i < 50; i++) { Mat instancePose = BuildPose(i * 0.3 - 1, 1 + i * 0.1); scene.AddInstance(modelId, instancePose); }
+
+	auto bvh = Bvh(&scene);
+	Mat camera = Math3D::BuildKMatrix(300, Size(160, 120));
+	Mat pose = BuildPose(0.1, 0);
+	auto renderer = SceneRenderer(camera, Size(160, 120));
+
+	// Execute
+	Mat image1, depth1, idImage1; renderer.Render(&scene, pose, image1, depth1, idImage1);
+	Mat image2, depth2, idImage2; renderer.Render(&scene, &bvh, pose, image2, depth2, idImage2);
+
+	// Confirm
+	auto rendered = 0;
+	for (auto i = 0; i < (int)depth1.total(); i++)
+	{
+		ASSERT_EQ(((float *)depth1.data)[i], ((float *)depth2.data)[i]);
+		ASSERT_EQ(((int *)idImage1.data)[i], ((int *)idImage2.data)[i]);
+		if (((int *)idImage1.data)[i] >= 0) rendered++;
+	}
+	ASSERT_GT(rendered, 0);
+}
@@ -0,0 +1,151 @@
+//--------------------------------------------------
+// Unit Tests for class Scene
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/FileUtils.h>
+#include <NVLib/SaveUtils.h>
+#include <NVLib/LoadUtils.h>
+#include <NVLib/Model/Scene.h>
+using namespace NVLib;
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Build a test model
+ * @return Model* The resultant model
+ */
+static Model * BuildModel()
+{
+	auto result = new Model();
+	for (auto i = 0; i < 10; i++) result->AddVertex(Point3d(i, 0, 1), Vec3i(i, 0, 0));
+	return result;
+}
+
+/**
+ * @brief Build a pose that is a pure translation
+ * @param x The translation along the x axis
+ * @return Mat The resultant 4x4 pose
+ */
+static Mat BuildPose(double x)
+{
+	Mat result = Mat_<double>::eye(4, 4);
+	result.at<double>(0, 3) = x;
+	return result;
+}
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that instances share their model and are only transformed when flattened
+ */
+TEST(Scene_Test, instances_share_models)
+{
+	// Setup
+	auto scene = Scene();
+	Mat pose1 = BuildPose(0); Mat pose2 = BuildPose(100);
+
+	// Execute
+	auto instance = scene.AddModel(BuildModel(), pose1);
+	scene.AddInstance(scene.GetInstances()[instance].GetModelId(), pose2);
+	auto flattened = scene.GetFlattened();
+
+	// Confirm
+	ASSERT_EQ(scene.ModelCount(), 1);
+	ASSERT_EQ(scene.InstanceCount(), 2);
+	ASSERT_EQ(scene.VertexCount(), 20);
+	ASSERT_EQ(flattened->VertexCount(), 20);
+	ASSERT_EQ(scene.GetModels()[0]->GetLocation(3).x, 3);
+	ASSERT_EQ(flattened->GetLocation(3).x, 3);
+	ASSERT_EQ(flattened->GetLocation(13).x, 103);
+	ASSERT_EQ(flattened->GetColor(13)[0], 3);
+	ASSERT_EQ(scene.GetLocation(1, 3).x, 103);
+}
+
+/**
+ * @brief Confirm that moving an instance refreshes the flattened view
+ */
+TEST(Scene_Test, set_pose_invalidates_flattened)
+{
+	// Setup
+	auto scene = Scene();
+	Mat pose = BuildPose(0); auto instance = scene.AddModel(BuildModel(), pose);
+	ASSERT_EQ(scene.GetFlattened()->GetLocation(5).x, 5);
+
+	// Execute
+	Mat moved = BuildPose(-10); scene.SetPose(instance, moved);
+
+	// Confirm
+	ASSERT_EQ(scene.GetFlattened()->GetLocation(5).x, -5);
+}
+
+/**
+ * @brief Confirm that a scene is exported with every instance in scene coordinates
+ */
+TEST(Scene_Test, save_scene)
+{
+	// Setup
+	auto scene = Scene();
+	Mat pose1 = BuildPose(0); Mat pose2 = BuildPose(100);
+	auto instance = scene.AddModel(BuildModel(), pose1);
+	scene.AddInstance(scene.GetInstances()[instance].GetModelId(), pose2);
+
+	// Execute
+	SaveUtils::SaveScene("scene.ply", &scene, true);
+	auto actual = LoadUtils::LoadModel("scene.ply");
+
+	// Confirm
+	ASSERT_EQ(actual->VertexCount(), 20);
+	ASSERT_NEAR(actual->GetLocation(15).x, 105, 1e-4);
+	ASSERT_EQ(actual->GetColor(15)[0], 5);
+
+	// Teardown
+	delete actual;
+	FileUtils::Remove("scene.ply");
+}
+
+/**
+ * @brief Confirm that vertices on the z = 0 plane of a model are kept once the instance pose moves them off it
+ */
+TEST(Scene_Test, save_scene_model_plane)
+{
+	// Setup
+	auto model = new Model();
+	for (auto i = 0; i < 10; i++) model->AddVertex(Point3d(i, i % 2, 0), Vec3i(i, 0, 0));
+
+	auto scene = Scene();
+	Mat pose1 = BuildPose(0); pose1.at<double>(2, 3) = 2;
+	Mat pose2 = BuildPose(0);
+	auto instance = scene.AddModel(model, pose1);
+	scene.AddInstance(scene.GetInstances()[instance].GetModelId(), pose2);
+
+	// Execute
+	SaveUtils::SaveScene("scene_plane.ply", &scene, true);
+	SaveUtils::SaveModel("scene_flat.ply", scene.GetFlattened(), true);
+	auto actual = LoadUtils::LoadModel("scene_plane.ply");
+	auto expected = LoadUtils::LoadModel("scene_flat.ply");
+
+	// Confirm
+	ASSERT_EQ(actual->VertexCount(), 10);
+	ASSERT_EQ(expected->VertexCount(), actual->VertexCount());
+
+	for (auto i = 0; i < actual->VertexCount(); i++)
+	{
+		ASSERT_NEAR(actual->GetLocation(i).x, i, 1e-4);
+		ASSERT_NEAR(actual->GetLocation(i).z, 2, 1e-4);
+		ASSERT_NEAR(actual->GetLocation(i).x, expected->GetLocation(i).x, 1e-4);
+	}
+
+	// Teardown
+	delete actual; delete expected;
+	FileUtils::Remove("scene_plane.ply"); FileUtils::Remove("scene_flat.ply");
+}
@@ -0,0 +1,89 @@
+//--------------------------------------------------
+// Unit Tests for class TsdfVolume
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/Math3D.h>
+#include <NVLib/Fusion/TsdfVolume.h>
+using namespace NVLib;
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Build the pose of a camera that has been moved sideways (maps world points into the camera frame)
+ * @param offset The distance that the camera was moved along the x axis
+ * @return Mat The resultant 4x4 pose
+ */
+static Mat BuildPose(double offset)
+{
+	Mat result = Mat_<double>::eye(4, 4);
+	result.at<double>(0, 3) = -offset;
+	return result;
+}
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that fusing frames of a wall recovers the wall and its color
+ */
+TEST(TsdfVolume_Test, fuse_wall)
+{
+	// Setup
+	auto size = Size(64, 48);
+	Mat camera = Math3D::BuildKMatrix(60, size);
+	Mat depth = Mat(size, CV_16U, Scalar(1000));
+	Mat color = Mat(size, CV_8UC3, Scalar(10, 20, 30));
+	auto frame = DepthFrame(color, depth);
+	auto volume = TsdfVolume(0.02);
+
+	// Execute
+	Mat pose1 = BuildPose(0); volume.Integrate(&frame, camera, pose1, 1e-3);
+	Mat pose2 = BuildPose(0.1); volume.Integrate(&frame, camera, pose2, 1e-3);
+	Mat cloud = volume.ExtractCloud();
+
+	// Confirm
+	ASSERT_GT(cloud.rows, 100);
+	for (auto i = 0; i < cloud.rows; i++)
+	{
+		auto point = cloud.ptr<double>(i);
+		ASSERT_NEAR(point[2], 1.0, 1e-3);
+		ASSERT_NEAR(point[3], 10, 1e-3); ASSERT_NEAR(point[4], 20, 1e-3); ASSERT_NEAR(point[5], 30, 1e-3);
+	}
+}
+
+/**
+ * @brief Confirm that the memory of the volume does not grow when the same view is fused again
+ */
+TEST(TsdfVolume_Test, repeated_frames_do_not_grow)
+{
+	// Setup
+	auto size = Size(64, 48);
+	Mat camera = Math3D::BuildKMatrix(60, size);
+	Mat depth = Mat(size, CV_32F, Scalar(1.5));
+	Mat color;
+	Mat pose = BuildPose(0);
+	auto volume = TsdfVolume(0.02);
+	volume.Integrate(color, depth, camera, pose);
+	auto blockCount = volume.GetBlockCount();
+
+	// Execute
+	for (auto i = 0; i < 5; i++) volume.Integrate(color, depth, camera, pose);
+	Model * model = volume.ExtractModel();
+
+	// Confirm
+	ASSERT_EQ(volume.GetBlockCount(), blockCount);
+	ASSERT_GT(model->VertexCount(), 100);
+	for (auto z : model->GetZ()) ASSERT_NEAR(z, 1.5, 1e-3);
+
+	// Teardown
+	delete model;
+}
@@ -0,0 +1,127 @@
+//--------------------------------------------------
+// Unit Tests for class VoxelUtils
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/VoxelUtils.h>
+using namespace NVLib;
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the points of a model are merged into the centroid of their voxel
+ */
+TEST(VoxelUtils_Test, downsample_model)
+{
+	// Setup
+	auto model = Model();
+	model.AddVertex(Point3d(0.1, 0.1, 0.1), Vec3i(10, 20, 30));
+	model.AddVertex(Point3d(0.3, 0.5, 0.7), Vec3i(30, 40, 50));
+	model.AddVertex(Point3d(-0.5, 0.5, 0.5), Vec3i(100, 100, 100));
+
+	// Execute
+	auto result = VoxelUtils::Downsample(&model, 1.0);
+
+	// Confirm
+	ASSERT_EQ(result->VertexCount(), 2);
+
+	for (auto i = 0; i < result->VertexCount(); i++)
+	{
+		auto vertex = result->GetVertex(i);
+
+		if (vertex.GetLocation().x < 0) 
+		{
+			ASSERT_NEAR(vertex.GetLocation().x, -0.5, 1e-9);
+			ASSERT_EQ(vertex.GetColor()[0], 100);
+		}
+		else 
+		{
+			ASSERT_NEAR(vertex.GetLocation().x, 0.2, 1e-9);
+			ASSERT_NEAR(vertex.GetLocation().y, 0.3, 1e-9);
+			ASSERT_NEAR(vertex.GetLocation().z, 0.4, 1e-9);
+			ASSERT_EQ(vertex.GetColor()[0], 20); ASSERT_EQ(vertex.GetColor()[1], 30); ASSERT_EQ(vertex.GetColor()[2], 40);
+		}
+	}
+
+	// Teardown
+	delete result;
+}
+
+/**
+ * @brief Confirm that a dense cloud is reduced to one point per occupied voxel, skipping invalid points
+ */
+TEST(VoxelUtils_Test, downsample_cloud)
+{
+	// Setup
+	Mat cloud = Mat::zeros(100, 100, CV_64FC(6));
+	for (auto row = 0; row < cloud.rows; row++)
+	{
+		for (auto column = 0; column < cloud.cols; column++)
+		{
+			if (row == column) continue;
+			auto point = cloud.ptr<double>(row) + column * 6;
+			point[0] = column * 0.01; point[1] = row * 0.01; point[2] = 1; point[3] = point[4] = point[5] = 128;
+		}
+	}
+
+	// Execute
+	Mat actual = VoxelUtils::Downsample(cloud, 0.1);
+
+	// Confirm
+	ASSERT_EQ(actual.rows, 100);
+	ASSERT_EQ(actual.type(), CV_64FC(6));
+
+	for (auto i = 0; i < actual.rows; i++)
+	{
+		auto point = actual.ptr<double>(i);
+		ASSERT_EQ(point[2], 1); ASSERT_EQ(point[3], 128);
+	}
+}
+
+/**
+ * @brief Confirm that the voxels come back in the order that they are first reached, whatever the number of threads
+ */
+TEST(VoxelUtils_Test, downsample_order)
+{
+	// Setup
+	auto model = Model();
+	for (auto i = 0; i < 50000; i++) model.AddVertex(Point3d((i * 37) % 101 + 0.5, (i * 11) % 7 + 0.5, 1.5), Vec3i(i % 255, 0, 0));
+
+	// Execute
+	auto result = VoxelUtils::Downsample(&model, 1.0);
+
+	// Confirm
+	ASSERT_EQ(result->VertexCount(), 707);
+	for (auto i = 0; i < result->VertexCount(); i++)
+	{
+		auto location = model.GetVertex(i).GetLocation();
+		ASSERT_NEAR(result->GetVertex(i).GetLocation().x, location.x, 1e-9);
+		ASSERT_NEAR(result->GetVertex(i).GetLocation().y, location.y, 1e-9);
+	}
+
+	// Teardown
+	delete result;
+}
+
+/**
+ * @brief Confirm that points that are too far away to be keyed are rejected, rather than aliasing other voxels
+ */
+TEST(VoxelUtils_Test, downsample_out_of_range)
+{
+	// Setup
+	auto model = Model();
+	model.AddVertex(Point3d(0.5, 0.5, 0.5), Vec3i(10, 20, 30));
+	model.AddVertex(Point3d((1 << 21) + 0.5, 0.5, 0.5), Vec3i(30, 40, 50));
+
+	// Execute and Confirm
+	ASSERT_THROW(VoxelUtils::Downsample(&model, 1.0), runtime_error);
+	ASSERT_THROW(VoxelUtils::GetVoxelKey(Point3d(0.5, -(1 << 20) - 0.5, 0.5), 1.0), runtime_error);
+	ASSERT_NO_THROW(VoxelUtils::GetVoxelKey(Point3d(0.5, -(1 << 20) + 0.5, 0.5), 1.0));
+}